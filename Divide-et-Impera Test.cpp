@@ -0,0 +1,134 @@
+/* Divide and Conquer (tests)
+Checks the functions of DivideEtImpera.h against std::minmax_element, std::accumulate and std::sort:
+DAC_MinMax() and minMaxIndex() on every small length, the parallelDAC() instances on pools of 1 and 3 threads,
+chunkedMinMax() with several thread counts and chunk sizes, and SparseTable and SegmentTree on random queries.
+Prints each failure and returns 1 if there was any (run by ctest).
+*/
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <numeric>
+#include <algorithm>
+#include "DivideEtImpera.h"
+using namespace std;
+using namespace dac;
+
+int failures = 0;
+int cases = 0;
+
+void check(bool ok, const char* what, long long n){
+   cases++;
+   if (!ok){
+      failures++;
+      cout << "FAILED: " << what << " on " << n << " elements" << endl;
+   }
+}
+
+vector<int> randomInput(long long n, int range, mt19937& gen){
+   vector<int> a(n);
+   for (int& x : a)
+      x = (int)(gen() % range) - range / 2;
+   return a;
+}
+
+bool sameMinMax(MinMax r, const vector<int>& a){
+   auto m = minmax_element(a.begin(), a.end());
+   return r.min == *m.first && r.max == *m.second;
+}
+
+// DAC_MinMax() on every length up to a few leaves, and minMaxIndex() with many ties (first index wins)
+void checkSequential(mt19937& gen){
+   for (int n = 1; n <= 300; n++){
+      vector<int> a = randomInput(n, 1000, gen);
+      MinMax r = DAC_MinMax(a.data(), 0, n - 1);
+      check(sameMinMax(r, a) && DAC_Max(a.data(), 0, n) == r.max && DAC_Min(a.data(), 0, n) == r.min, "DAC_MinMax", n);
+   }
+   for (int n : { 1, 2, 15, 16, 17, 31, 32, 33, 100, 1000, 100003 }){
+      for (int range : { 3, 1000000 }){
+         vector<int> a = randomInput(n, range, gen);
+         sorting::MinMaxIndex r = sorting::minMaxIndex(a.data(), n);
+         long long minIndex = min_element(a.begin(), a.end()) - a.begin();
+         long long maxIndex = max_element(a.begin(), a.end()) - a.begin();
+         check(r.minIndex == minIndex && r.maxIndex == maxIndex && r.min == a[minIndex] && r.max == a[maxIndex],
+               "minMaxIndex", n);
+      }
+   }
+}
+
+// The parallelDAC() instances; sizes around CUTOFF, and organ-pipe input for the quick sort depth budget
+void checkPool(mt19937& gen){
+   for (int threads : { 1, 3 }){
+      WorkStealingPool pool(threads);
+      for (long n : { 1L, 2L, 5L, CUTOFF, CUTOFF + 1, 5 * CUTOFF + 17, 300000L }){
+         vector<int> a = randomInput(n, 1 << 30, gen);
+         check(sameMinMax(parallelMinMax(pool, a.data(), n), a), "parallelMinMax", n);
+         check(parallelSum(pool, a.data(), n) == accumulate(a.begin(), a.end(), 0LL), "parallelSum", n);
+         vector<int> expected = a;
+         std::sort(expected.begin(), expected.end());
+         vector<int> b = a;
+         parallelMergeSort(pool, b.data(), n);
+         check(b == expected, "parallelMergeSort", n);
+         b = a;
+         parallelQuickSort(pool, b.data(), n);
+         check(b == expected, "parallelQuickSort", n);
+         for (long i = 0; i < n; i++)
+            b[i] = (int)((i < n / 2) ? i : n - i);
+         expected = b;
+         std::sort(expected.begin(), expected.end());
+         parallelQuickSort(pool, b.data(), n);
+         check(b == expected, "parallelQuickSort on organ-pipe input", n);
+      }
+   }
+}
+
+void checkChunked(mt19937& gen){
+   for (long long n : { 1LL, 7LL, 1000LL, 200001LL }){
+      vector<int> a = randomInput(n, 1 << 30, gen);
+      for (int threads : { 1, 2, 4 })
+         for (long long chunk : { 1LL, 7LL, 1LL << 16 })
+            check(sameMinMax(chunkedMinMax(a.data(), n, threads, chunk), a), "chunkedMinMax", n);
+   }
+}
+
+void checkRangeQueries(mt19937& gen){
+   for (int n : { 1, 2, 3, 64, 1000 }){
+      vector<int> a = randomInput(n, 1000, gen);
+      SegmentTree tree(a.data(), n);
+      bool ok = true;
+      for (int q = 0; q < 500; q++){
+         if (q % 5 == 0){
+            int i = (int)(gen() % n), value = (int)(gen() % 1000);
+            a[i] = value;
+            tree.update(i, value);
+         }
+         int i = (int)(gen() % n), j = (int)(gen() % n);
+         if (i > j)
+            swap(i, j);
+         vector<int> part(a.begin() + i, a.begin() + j + 1);
+         ok = ok && sameMinMax(tree.query(i, j), part);
+      }
+      check(ok, "SegmentTree update/query", n);
+      // The sparse table is static: rebuild it on the updated values
+      SparseTable updated(a.data(), n);
+      ok = true;
+      for (int q = 0; q < 500; q++){
+         int i = (int)(gen() % n), j = (int)(gen() % n);
+         if (i > j)
+            swap(i, j);
+         vector<int> part(a.begin() + i, a.begin() + j + 1);
+         ok = ok && sameMinMax(updated.query(i, j), part);
+      }
+      check(ok, "SparseTable query", n);
+   }
+}
+
+int main(){
+   mt19937 gen(1);
+   checkSequential(gen);
+   checkPool(gen);
+   checkChunked(gen);
+   checkRangeQueries(gen);
+   cout << cases << " cases, " << failures << " failures" << endl;
+   return failures == 0 ? 0 : 1;
+}
@@ -89,59 +89,401 @@ return a[index];
 // min will be minimum in a given array.
 else
 return min;
+
+These steps peel off one element per call, so the recursion is n levels deep. DAC_Max() and DAC_Min() of
+DivideEtImpera.h keep the same signatures but split a[index..l-1] in halves through DAC_MinMax() (next section).
 */
 
 #include <stdio.h>
-int DAC_Max(int a[], int index, int l);
-int DAC_Min(int a[], int index, int l);
-
-// function to find the maximum in a given array.
-int DAC_Max(int a[], int index, int l){
-   int max;
-   if (index >= l - 2){
-      if (a[index] > a[index + 1])
-         return a[index];
-      else
-         return a[index + 1];
-    }
-
-    // logic to find the max in the given array.
-    max = DAC_Max(a, index + 1, l);
-    if (a[index] > max)
-        return a[index];
-    else
-        return max;
-}
-
-// Function to find the minimum in a given array.
-int DAC_Min(int a[], int index, int l){
-   int min;
-   if (index >= l - 2) {
-      if (a[index] < a[index + 1])
-         return a[index];
-      else
-         return a[index + 1];
-    }
-
-    // Logic to find the min in the given array.
-    min = DAC_Min(a, index + 1, l); 
-    if (a[index] < min)
-        return a[index];
-    else
-        return min;
-}
+#include "DivideEtImpera.h"
+using namespace dac;
 
 // Driver Code
 int main(){
    // Defining the variables
-   int min, max, N;
+   int min, max;
    // Initializing the array
    int a[7] = { 70, 250, 50, 80, 140, 12, 14 };
    // recursion - DAC_Max function called
    max = DAC_Max(a, 0, 7);
-   // recursion - DAC_Max function called
+   // recursion - DAC_Min function called
    min = DAC_Min(a, 0, 7);
    printf("The minimum number in a given array is : %d\n", min);
    printf("The maximum number in a given array is : %d", max);
    return 0;
 }
+
+
+/* Divide and Conquer Min and Max (halving)
+The steps above divide the problem into a[index] and a[index+1..l-1], so the recursion is n levels deep:
+it is really a linear scan, and on arrays of a few hundred thousand elements the call stack overflows.
+They also scan the array twice, once for each result.
+
+Following the DAC() scheme literally:
+small(a, i, j):    at most LEAF elements left
+solution(a, i, j): an iterative loop over a[i..j]
+divide(a, i, j):   mid = i + (j - i) / 2, so each half has about n/2 elements and the depth is only log2(n / LEAF)
+combine(b, c):     min of the two minimums, max of the two maximums
+
+The leaf loop finds both results in one pass with the pairwise scheme:
+take two elements, compare them with each other, then compare only the smaller with min and only the larger with max.
+That is 3 comparisons per 2 elements (3n/2 in total) instead of 2 per element (2n) for two separate scans.
+
+Example:
+Input: { 70, 250, 50, 80, 140, 12, 14 }
+Pairs: (70, 250) -> min 70, max 250; (50, 80) -> min 50; (140, 12) -> min 12; 14 alone
+Output: min 12, max 250
+
+Time Complexity:
+Best: Ω(n)
+Average: θ(n), 3n/2 comparisons
+Worst: O(n), recursion depth O(log(n))
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "DivideEtImpera.h"
+using namespace dac;
+
+// Driver Code
+int main(){
+   int a[7] = { 70, 250, 50, 80, 140, 12, 14 };
+   struct MinMax r = DAC_MinMax(a, 0, 6);
+   printf("The minimum number in a given array is : %d\n", r.min);
+   printf("The maximum number in a given array is : %d\n", r.max);
+
+   // Ten million elements: the linear recursion would need ten million stack frames
+   int n = 10000000;
+   int *big = (int *)malloc(n * sizeof(int));
+   if (big == NULL)
+      return 1;
+   for (int i = 0; i < n; i++)
+      big[i] = (int)((i * 2654435761u) % 1000000007u);
+   r = DAC_MinMax(big, 0, n - 1);
+   printf("Min and max of %d elements: %d %d\n", n, r.min, r.max);
+   free(big);
+   return 0;
+}
+
+
+/* Vectorized Min and Max with Indices
+Even the halving DAC_MinMax() compares one int at a time. On large columns the comparisons can be done
+8 (AVX2) or 16 (AVX-512) at a time, which is enough to be limited by memory bandwidth instead of by the CPU.
+
+Algorithm:
+1. Keep vectors of running minimums and maximums and, lane by lane, the index where each was seen.
+2. For each vector x of the input: lanes where x < min (strictly, so the first occurrence wins) take
+   the new value and the current index (the compare gives a mask, and a blend picks value and index by that mask).
+   The same with x > max.
+3. Two independent sets of accumulators are updated in turn, so one comparison does not wait for the previous one.
+4. At the end reduce the lanes (smallest value, and on ties the smallest index), then scan the last elements
+   that do not fill a vector with the scalar loop.
+Lane indices are 32-bit, so arrays longer than 2^30 elements are processed in chunks and the results combined,
+just like combine() in DAC().
+
+The best kernel is chosen once at runtime (AVX-512, else AVX2, else scalar). It is the one scan kernel
+of the repository (Sorting & Searching/MinMax.h): the threaded reduction below and Selection Sort use it too.
+
+Time Complexity:
+Best: Ω(n)
+Average: θ(n), n/16 vector steps with AVX-512
+Worst: O(n)
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Sorting & Searching/MinMax.h"
+using namespace sorting;
+
+// Driver Code
+int main(){
+   int a[7] = { 70, 250, 50, 80, 140, 12, 14 };
+   struct MinMaxIndex r = minMaxIndex(a, 7);
+   printf("The minimum number in a given array is : %d (index %lld)\n", r.min, r.minIndex);
+   printf("The maximum number in a given array is : %d (index %lld)\n", r.max, r.maxIndex);
+
+   int n = 50000000;
+   int *big = (int *)malloc(n * sizeof(int));
+   if (big == NULL)
+      return 1;
+   for (int i = 0; i < n; i++)
+      big[i] = (int)((i * 2654435761u) % 1000000007u);
+   clock_t t0 = clock();
+   struct MinMaxIndex s = minMaxIndexScalar(big, n);
+   clock_t t1 = clock();
+   r = minMaxIndex(big, n);
+   clock_t t2 = clock();
+   double scalarMs = 1000.0 * (t1 - t0) / CLOCKS_PER_SEC, simdMs = 1000.0 * (t2 - t1) / CLOCKS_PER_SEC;
+   printf("%d elements: min %d at %lld, max %d at %lld\n", n, r.min, r.minIndex, r.max, r.maxIndex);
+   printf("scalar %.1f ms (%.2f GB/s), vector %.1f ms (%.2f GB/s)%s\n",
+          scalarMs, n * 4.0 / scalarMs / 1e6, simdMs, n * 4.0 / simdMs / 1e6,
+          (s.min == r.min && s.max == r.max && s.minIndex == r.minIndex && s.maxIndex == r.maxIndex) ? "" : " (results differ!)");
+   free(big);
+   return 0;
+}
+
+
+/* Parallel Divide and Conquer (generic)
+DAC(a, i, j) at the top is one scheme with four parts: small, solution, divide and combine.
+parallelDAC() takes exactly those four parts as functions, so every divide and conquer algorithm is a few lines,
+and the two halves b and c are computed in parallel because they are independent:
+
+parallelDAC(p){
+    if(isSmall(p))
+      return solve(p)                   // sequential cutoff: below it a task would cost more than it saves
+    (left, right) = divide(p)
+    spawn b = parallelDAC(left)          // a task other threads can take
+    c = parallelDAC(right)               // done by this thread meanwhile
+    wait for b                           // running other tasks while waiting
+    return combine(b, c)
+}
+
+The tasks run on a work-stealing pool. Every thread has its own deque of tasks: it pushes and pops at the back
+(the newest, smallest task, whose data is still in cache), and an idle thread steals from the front of another
+deque (the oldest task, usually the biggest piece of work, so steals are rare).
+A thread waiting for b keeps running tasks instead of blocking, and most of the time the first task it pops is b itself.
+The thread that calls parallelDAC() acts as worker 0.
+
+Instances (all sharing one pool):
+min and max: the leaves are DAC_MinMax() above, combine is its combine()
+sum:         combine adds
+merge sort:  divide splits in the middle, combine merges the two sorted halves
+quick sort:  divide partitions around a median of three medians of three, combine has nothing to do;
+             after 2 log2(n) levels of parallel partitions the rest of a range is sorted sequentially,
+             so bad pivots cannot pile up Tasks n/k levels deep
+The sort leaves use the sequential engines of sort() (Sorting & Searching/MergeSort.h and QuickSort.h):
+merge sort with one scratch buffer and insertion sort on small runs, quick sort with a median of three pivot
+and a heap sort fallback.
+
+Time Complexity (P threads, cutoff k):
+min/max, sum: O(n/P + log(n/k))
+merge sort:   O(n log(n) / P + n), the last merge is sequential
+quick sort:   O(n log(n) / P + n) on average, the first partition is sequential
+*/
+
+#include <bits/stdc++.h>
+#include "DivideEtImpera.h"
+using namespace std;
+using namespace dac;
+
+template <typename F>
+double timeMs(F f){
+   auto start = chrono::steady_clock::now();
+   f();
+   return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// Driver Code (pass n and the number of threads as arguments)
+int main(int argc, char** argv){
+   long n = (argc > 1) ? atol(argv[1]) : 10000000;
+   int threads = (argc > 2) ? atoi(argv[2]) : (int)max(1u, thread::hardware_concurrency());
+   WorkStealingPool pool(threads);
+
+   int example[7] = { 70, 250, 50, 80, 140, 12, 14 };
+   MinMax r = parallelMinMax(pool, example, 7);
+   cout << "The minimum number in a given array is : " << r.min << "\n";
+   cout << "The maximum number in a given array is : " << r.max << "\n";
+
+   if (n < 1)
+      return 0;
+   vector<int> data(n);
+   mt19937 gen(1);
+   for (int& v : data)
+      v = (int)(gen() % 1000000000);
+   vector<int> expected = data;
+   sort(expected.begin(), expected.end());
+
+   WorkStealingPool single(1);
+   cout << n << " elements, 1 thread against " << threads << " threads:\n";
+   for (WorkStealingPool* p : { &single, &pool }){
+      MinMax m;
+      long long s;
+      vector<int> a = data, b = data;
+      double tm = timeMs([&]{ m = parallelMinMax(*p, data.data(), n); });
+      double ts = timeMs([&]{ s = parallelSum(*p, data.data(), n); });
+      double tms = timeMs([&]{ parallelMergeSort(*p, a.data(), n); });
+      double tqs = timeMs([&]{ parallelQuickSort(*p, b.data(), n); });
+      bool ok = m.min == expected[0] && m.max == expected[n - 1]
+                && s == accumulate(data.begin(), data.end(), 0LL) && a == expected && b == expected;
+      cout << "  " << p->size() << " thread(s): min/max " << tm << " ms, sum " << ts << " ms, merge sort "
+           << tms << " ms, quick sort " << tqs << " ms" << (ok ? "" : " (wrong result!)") << "\n";
+   }
+   return 0;
+}
+
+
+/* Multi-threaded Min and Max (parallel reduction)
+A single core cannot read memory as fast as the memory can deliver it: even the vectorized scan stops at a few GB/s
+per thread, while the whole machine gives several times that. On arrays of billions of elements
+the scan is therefore split between threads, like one level of DAC() with T parts instead of 2.
+
+Algorithm:
+1. The array is cut into chunks of CHUNK elements. Thread t reduces chunks t, t+T, t+2T, ...
+   (a fixed assignment, so the thread that first wrote a chunk is the one that reads it again,
+   and on a NUMA machine the chunk is in the memory of that thread's node: first touch).
+   Each chunk is scanned with the vectorized minMaxIndex() above.
+2. Each thread keeps its running min and max in its own Partial, which is aligned and padded to a cache line (64 bytes).
+   Partials of different threads packed next to each other would share a line, and every update
+   would take the line away from the other threads (false sharing).
+3. When all threads have finished, the T partials are combined like combine(b, c) in DAC().
+
+Knobs: the number of threads and the chunk size (elements). Small chunks interleave the threads finely,
+large chunks keep each thread on long sequential runs, which the hardware prefetcher likes.
+
+The driver compares the achieved bandwidth with a STREAM-like copy (b[i] = a[i], counting the bytes
+read and written) run with the same threads, which is about what the machine's memory can deliver.
+Pass n, the number of threads and the chunk size as arguments.
+
+Time Complexity:
+Best: Ω(n/T)
+Average: θ(n/T + T)
+Worst: O(n/T + T)
+*/
+
+#include <bits/stdc++.h>
+#include "DivideEtImpera.h"
+using namespace std;
+using namespace dac;
+
+// Best time of a few runs, in ms
+template <typename F>
+double bestMs(F f){
+   double best = 1e300;
+   for (int run = 0; run < 5; run++){
+      auto start = chrono::steady_clock::now();
+      f();
+      best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+   }
+   return best;
+}
+
+// Driver Code
+int main(int argc, char** argv){
+   long long n = (argc > 1) ? atoll(argv[1]) : 100000000;
+   int threads = (argc > 2) ? atoi(argv[2]) : (int)max(1u, thread::hardware_concurrency());
+   long long chunk = (argc > 3) ? atoll(argv[3]) : 1 << 16;
+
+   int example[7] = { 70, 250, 50, 80, 140, 12, 14 };
+   MinMax r = chunkedMinMax(example, 7, threads, 2);
+   printf("The minimum number in a given array is : %d\n", r.min);
+   printf("The maximum number in a given array is : %d\n", r.max);
+   if (n < 1)
+      return 0;
+
+   // Written by the same threads and chunks that read it later (first touch)
+   int* a = (int*)malloc(n * sizeof(int));
+   int* b = (int*)malloc(n * sizeof(int));
+   if (a == NULL || b == NULL)
+      return 1;
+   forEachChunk(n, threads, chunk, [&](int, long long first, long long count){
+      for (long long i = first; i < first + count; i++){
+         a[i] = (int)(((unsigned long long)i * 2654435761u) % 1000000007u);
+         b[i] = 0;
+      }
+   });
+
+   double reduceMs = bestMs([&]{ r = chunkedMinMax(a, n, threads, chunk); });
+   double copyMs = bestMs([&]{
+      forEachChunk(n, threads, chunk, [&](int, long long first, long long count){
+         memcpy(b + first, a + first, count * sizeof(int));
+      });
+   });
+   sorting::MinMaxIndex single = sorting::minMaxIndex(a, n);
+   double reduceGBs = n * 4.0 / reduceMs / 1e6, copyGBs = 2 * n * 4.0 / copyMs / 1e6;
+   printf("%lld elements, %d threads, chunk %lld: min %d, max %d%s\n", n, threads, chunk, r.min, r.max,
+          (r.min == single.min && r.max == single.max) ? "" : " (wrong result!)");
+   printf("reduction %.1f ms (%.2f GB/s), copy %.1f ms (%.2f GB/s): %.0f%% of copy bandwidth\n",
+          reduceMs, reduceGBs, copyMs, copyGBs, 100 * reduceGBs / copyGBs);
+   free(a);
+   free(b);
+   return 0;
+}
+
+
+/* Range Minimum and Maximum Queries
+Answering "min and max of a[i..j]" by running DAC_Min() and DAC_Max() on the subrange costs O(j - i) every time.
+When the same array is queried many times it pays to keep the results of the divide step:
+
+Sparse table (static array):
+table[k][i] = min and max of a[i..i+2^k-1], the block of length 2^k starting at i.
+Built level by level from two blocks of the previous level: table[k][i] = combine(table[k-1][i], table[k-1][i+2^(k-1)]).
+A query covers a[i..j] with the two blocks of length 2^k, k = floor(log2(j-i+1)), that start at i and end at j.
+They overlap, which does not matter for min and max, so the query is two lookups and one combine.
+
+Segment tree (array with point updates), iterative and bottom-up:
+tree[n+i] = a[i] are the leaves, tree[p] = combine(tree[2p], tree[2p+1]) for p = n-1..1, so no recursion is needed.
+update(i, v): set the leaf, then recompute its ancestors p/2, p/4, ... (log2(n) nodes).
+query(i, j): start with l = i+n and r = j+n+1 and move both up one level at a time;
+whenever l is a right child (or r is), that node is entirely inside the range and is combined into the result.
+
+Example:
+Input: { 70, 250, 50, 80, 140, 12, 14 }, query a[1..3]
+Output: min 50, max 250
+
+Time Complexity:
+sparse table: build O(n log(n)), query O(1), memory O(n log(n)), no updates
+segment tree: build O(n), query O(log(n)), update O(log(n)), memory O(n)
+*/
+
+#include <bits/stdc++.h>
+#include "DivideEtImpera.h"
+using namespace std;
+using namespace dac;
+
+// Rescanning the subrange, as with DAC_Min() and DAC_Max()
+MinMax scan(const int a[], int i, int j){
+   MinMax r = { a[i], a[i] };
+   for (int k = i + 1; k <= j; k++)
+      r = combine(r, MinMax{ a[k], a[k] });
+   return r;
+}
+
+// Driver Code
+int main(){
+   int a[7] = { 70, 250, 50, 80, 140, 12, 14 };
+   SparseTable table(a, 7);
+   SegmentTree tree(a, 7);
+   MinMax r = table.query(1, 3);
+   printf("Min and max of a[1..3]: %d %d\n", r.min, r.max);
+   tree.update(2, 300);
+   r = tree.query(0, 6);
+   printf("After a[2] = 300, min and max of a[0..6]: %d %d\n", r.min, r.max);
+
+   // A million elements, queries over random ranges
+   const int N = 1000000, Q = 2000;
+   vector<int> big(N);
+   mt19937 gen(1);
+   for (int& v : big)
+      v = (int)(gen() % 1000000000);
+   vector<pair<int, int>> queries(Q);
+   for (auto& q : queries){
+      int i = gen() % N, j = gen() % N;
+      q = { min(i, j), max(i, j) };
+   }
+   auto t0 = chrono::steady_clock::now();
+   SparseTable bigTable(big.data(), N);
+   SegmentTree bigTree(big.data(), N);
+   auto t1 = chrono::steady_clock::now();
+   long long s1 = 0, s2 = 0, s3 = 0;
+   for (auto& q : queries){
+      MinMax m = scan(big.data(), q.first, q.second);
+      s1 += m.min + (long long)m.max;
+   }
+   auto t2 = chrono::steady_clock::now();
+   for (auto& q : queries){
+      MinMax m = bigTable.query(q.first, q.second);
+      s2 += m.min + (long long)m.max;
+   }
+   auto t3 = chrono::steady_clock::now();
+   for (auto& q : queries){
+      MinMax m = bigTree.query(q.first, q.second);
+      s3 += m.min + (long long)m.max;
+   }
+   auto t4 = chrono::steady_clock::now();
+   auto us = [](chrono::steady_clock::duration d){ return chrono::duration<double, micro>(d).count(); };
+   printf("%d queries on %d elements (build %.0f us): scan %.2f us, sparse table %.3f us, segment tree %.3f us per query%s\n",
+          Q, N, us(t1 - t0), us(t2 - t1) / Q, us(t3 - t2) / Q, us(t4 - t3) / Q,
+          (s1 == s2 && s2 == s3) ? "" : " (results differ!)");
+   return 0;
+}
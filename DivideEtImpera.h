@@ -0,0 +1,423 @@
+/* Divide and Conquer on arrays (Divide-et-Impera.cpp describes each one):
+DAC_MinMax()             - min and max by halving, pairwise comparison in the leaves
+DAC_Max(), DAC_Min()     - the same halving, one result each
+parallelDAC()            - the DAC() scheme on a work-stealing pool, with min/max, sum, merge sort and quick sort
+chunkedMinMax()          - multi-threaded reduction over chunks, one padded partial result per thread
+The vectorized min and max with indices, minMaxIndex(), is in Sorting & Searching/MinMax.h (namespace sorting):
+chunkedMinMax() and Selection Sort reduce with it.
+SparseTable, SegmentTree - range minimum and maximum queries
+*/
+
+#ifndef DIVIDE_ET_IMPERA_H
+#define DIVIDE_ET_IMPERA_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <utility>
+#include <climits>
+#include <cstring>
+#include "Sorting & Searching/MinMax.h"
+#include "Sorting & Searching/MergeSort.h"
+#include "Sorting & Searching/QuickSort.h"
+
+namespace dac {
+
+const int LEAF = 64; // elements below which DAC_MinMax() scans instead of dividing
+
+// Minimum and maximum of a range, returned together
+struct MinMax{
+   int min;
+   int max;
+};
+
+inline MinMax combine(MinMax b, MinMax c){
+   return MinMax{ std::min(b.min, c.min), std::max(b.max, c.max) };
+}
+
+// Iterative leaf kernel: pairwise comparison over a[i..j]
+inline struct MinMax minMaxLeaf(int a[], int i, int j){
+   struct MinMax r;
+   int k;
+   // Start from the first element (odd count) or the first pair (even count)
+   if ((j - i + 1) % 2 == 1){
+      r.min = r.max = a[i];
+      k = i + 1;
+   } else {
+      if (a[i] < a[i + 1]){
+         r.min = a[i];
+         r.max = a[i + 1];
+      } else {
+         r.min = a[i + 1];
+         r.max = a[i];
+      }
+      k = i + 2;
+   }
+   for (; k < j; k += 2){
+      int small = a[k], large = a[k + 1];
+      if (small > large){
+         small = a[k + 1];
+         large = a[k];
+      }
+      if (small < r.min)
+         r.min = small;
+      if (large > r.max)
+         r.max = large;
+   }
+   return r;
+}
+
+// Divide and conquer over a[i..j] (i <= j): halves until LEAF elements are left
+inline struct MinMax DAC_MinMax(int a[], int i, int j){
+   if (j - i + 1 <= LEAF)
+      return minMaxLeaf(a, i, j);
+   int mid = i + (j - i) / 2;
+   struct MinMax b = DAC_MinMax(a, i, mid);
+   struct MinMax c = DAC_MinMax(a, mid + 1, j);
+   struct MinMax d;
+   d.min = (b.min < c.min) ? b.min : c.min;
+   d.max = (b.max > c.max) ? b.max : c.max;
+   return d;
+}
+
+// The signatures of the first section of Divide-et-Impera.cpp: the maximum and minimum of a[index..l-1]
+inline int DAC_Max(int a[], int index, int l){
+   return DAC_MinMax(a, index, l - 1).max;
+}
+
+inline int DAC_Min(int a[], int index, int l){
+   return DAC_MinMax(a, index, l - 1).min;
+}
+
+// A unit of work that a thread can run; done is set when it has finished
+struct Task{
+   std::function<void()> run;
+   std::atomic<bool> done{false};
+};
+
+class WorkStealingPool{
+   struct Worker{
+      std::mutex lock;
+      std::deque<Task*> tasks;
+   };
+   std::vector<std::unique_ptr<Worker>> workers;
+   std::vector<std::thread> threads;
+   std::atomic<int> queued{0};   // tasks sitting in the deques
+   std::atomic<int> sleepers{0}; // idle threads waiting on wake
+   std::atomic<bool> stop{false};
+   std::mutex sleepLock;
+   std::condition_variable wake;
+   static inline thread_local WorkStealingPool* current = NULL;
+   static inline thread_local int self = 0;
+
+   int index(){
+      return (current == this) ? self : 0;
+   }
+   void workerLoop(int i);
+public:
+   explicit WorkStealingPool(int n);
+   ~WorkStealingPool();
+   WorkStealingPool(const WorkStealingPool&) = delete;
+   WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+   int size() { return (int)workers.size(); }
+   // Makes task available to the other threads (the task must outlive join())
+   void spawn(Task* task);
+   // Runs one task from this thread's deque or stolen from another; false if there was none
+   bool runOne();
+   // Waits until task has run, running other tasks meanwhile
+   void join(Task* task){
+      while (!task->done.load(std::memory_order_acquire))
+         if (!runOne())
+            std::this_thread::yield();
+   }
+};
+
+inline WorkStealingPool::WorkStealingPool(int n){
+   if (n < 1)
+      n = 1;
+   for (int i = 0; i < n; i++)
+      workers.push_back(std::make_unique<Worker>());
+   for (int i = 1; i < n; i++)
+      threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+
+inline WorkStealingPool::~WorkStealingPool(){
+   {
+      std::lock_guard<std::mutex> guard(sleepLock);
+      stop = true;
+   }
+   wake.notify_all();
+   for (std::thread& t : threads)
+      t.join();
+}
+
+inline void WorkStealingPool::spawn(Task* task){
+   Worker& w = *workers[index()];
+   {
+      std::lock_guard<std::mutex> guard(w.lock);
+      w.tasks.push_back(task);
+   }
+   queued.fetch_add(1);
+   if (sleepers.load() > 0){
+      std::lock_guard<std::mutex> guard(sleepLock);
+      wake.notify_one();
+   }
+}
+
+inline bool WorkStealingPool::runOne(){
+   int n = size(), me = index();
+   Task* task = NULL;
+   for (int k = 0; k < n && task == NULL; k++){
+      Worker& w = *workers[(me + k) % n];
+      std::lock_guard<std::mutex> guard(w.lock);
+      if (w.tasks.empty())
+         continue;
+      if (k == 0){
+         task = w.tasks.back(); // own deque: newest first
+         w.tasks.pop_back();
+      } else {
+         task = w.tasks.front(); // steal: oldest first
+         w.tasks.pop_front();
+      }
+   }
+   if (task == NULL)
+      return false;
+   queued.fetch_sub(1);
+   task->run();
+   task->done.store(true, std::memory_order_release);
+   return true;
+}
+
+inline void WorkStealingPool::workerLoop(int i){
+   current = this;
+   self = i;
+   while (true){
+      if (runOne())
+         continue;
+      std::unique_lock<std::mutex> guard(sleepLock);
+      sleepers.fetch_add(1);
+      wake.wait(guard, [&]{ return stop.load() || queued.load() > 0; });
+      sleepers.fetch_sub(1);
+      if (stop)
+         return;
+   }
+}
+
+// The generic scheme: divide(p) returns the two subproblems, combine(b, c) their joint result
+template <typename Problem, typename IsSmall, typename Solve, typename Divide, typename Combine>
+auto parallelDAC(WorkStealingPool& pool, const Problem& p, IsSmall isSmall, Solve solve, Divide divide, Combine combine)
+      -> decltype(solve(p)){
+   if (isSmall(p))
+      return solve(p);
+   std::pair<Problem, Problem> parts = divide(p);
+   decltype(solve(p)) b{};
+   Task left;
+   left.run = [&]{ b = parallelDAC(pool, parts.first, isSmall, solve, divide, combine); };
+   pool.spawn(&left);
+   auto c = parallelDAC(pool, parts.second, isSmall, solve, divide, combine);
+   pool.join(&left);
+   return combine(b, c);
+}
+
+const long CUTOFF = 1 << 14; // elements below which a subproblem is solved sequentially
+
+// The range a[lo..hi-1]; tmp is scratch space as long as a (used by merge sort),
+// depth the number of parallel partitions quick sort may still do
+struct Range{
+   int* a;
+   int* tmp;
+   long lo;
+   long hi;
+   int depth = 0;
+};
+
+inline bool smallRange(const Range& r){
+   return r.hi - r.lo <= CUTOFF;
+}
+
+inline std::pair<Range, Range> halve(const Range& r){
+   long mid = r.lo + (r.hi - r.lo) / 2;
+   return { { r.a, r.tmp, r.lo, mid }, { r.a, r.tmp, mid, r.hi } };
+}
+
+// a[0..n-1], n >= 1; the leaves are solved by DAC_MinMax()
+inline MinMax parallelMinMax(WorkStealingPool& pool, int a[], long n){
+   auto solve = [](const Range& r){ return DAC_MinMax(r.a + r.lo, 0, (int)(r.hi - r.lo) - 1); };
+   return parallelDAC(pool, Range{ a, NULL, 0, n }, smallRange, solve, halve,
+                      [](MinMax b, MinMax c){ return combine(b, c); });
+}
+
+inline long long parallelSum(WorkStealingPool& pool, int a[], long n){
+   auto solve = [](const Range& r){
+      long long s = 0;
+      for (long k = r.lo; k < r.hi; k++)
+         s += r.a[k];
+      return s;
+   };
+   return parallelDAC(pool, Range{ a, NULL, 0, n }, smallRange, solve, halve,
+                      [](long long b, long long c){ return b + c; });
+}
+
+// Merge sort: each result is the sorted range, combine merges two neighbouring ranges through tmp
+inline void parallelMergeSort(WorkStealingPool& pool, int a[], long n){
+   std::vector<int> tmp(n);
+   auto solve = [](const Range& r){
+      if (r.hi - r.lo > 1)
+         sorting::mergeSort(r.a, r.tmp, r.lo, r.hi - 1);
+      return r;
+   };
+   auto combine = [](const Range& b, const Range& c){
+      if (b.a[b.hi - 1] > c.a[c.lo])
+         sorting::merge(b.a, b.tmp, b.lo, b.hi - 1, c.hi - 1);
+      return Range{ b.a, b.tmp, b.lo, c.hi };
+   };
+   parallelDAC(pool, Range{ a, tmp.data(), 0, n }, smallRange, solve, halve, combine);
+}
+
+inline int median3(int x, int y, int z){
+   return std::max(std::min(x, y), std::min(std::max(x, y), z));
+}
+
+// Hoare partition of a[lo..hi-1] (at least 9 elements) around the median of three medians of three
+// spread over the range (Tukey's ninther, harder to fool than the first, middle and last); both parts are non-empty
+inline std::pair<Range, Range> partitionRange(const Range& r){
+   int* a = r.a;
+   long s = (r.hi - r.lo) / 8, m = r.lo + (r.hi - r.lo) / 2;
+   int pivot = median3(median3(a[r.lo], a[r.lo + s], a[r.lo + 2 * s]), median3(a[m - s], a[m], a[m + s]),
+                       median3(a[r.hi - 1 - 2 * s], a[r.hi - 1 - s], a[r.hi - 1]));
+   long i = r.lo - 1, j = r.hi;
+   while (true){
+      do i++; while (a[i] < pivot);
+      do j--; while (a[j] > pivot);
+      if (i >= j)
+         break;
+      std::swap(a[i], a[j]);
+   }
+   return { { a, NULL, r.lo, j + 1, r.depth - 1 }, { a, NULL, j + 1, r.hi, r.depth - 1 } };
+}
+
+// Quick sort of a[0..n-1], n < 2^31 like the sequential engines: divide does the work, the two parts are already
+// in place. Bad pivots could make the parallel recursion about n/CUTOFF levels deep, each one holding a Task;
+// after 2 log2(n) levels (as in Introsort) the rest of the range is left to the sequential quickSort(),
+// which has its own depth limit
+inline void parallelQuickSort(WorkStealingPool& pool, int a[], long n){
+   if (n < 2)
+      return;
+   auto isSmall = [](const Range& r){ return smallRange(r) || r.depth == 0; };
+   auto solve = [](const Range& r){
+      int len = (int)(r.hi - r.lo);
+      if (len > 1)
+         sorting::quickSort(r.a + r.lo, len);
+      return r;
+   };
+   auto combine = [](const Range& b, const Range& c){ return Range{ b.a, NULL, b.lo, c.hi }; };
+   int depth = 2 * (63 - __builtin_clzll((unsigned long long)n));
+   parallelDAC(pool, Range{ a, NULL, 0, n, depth }, isSmall, solve, partitionRange, combine);
+}
+
+// One thread's result, on its own cache line
+struct alignas(64) Partial{
+   MinMax r;
+   bool empty;
+};
+
+// Runs work(t, first, count) in threads t = 0..threads-1 for chunks t, t+threads, ... of [0, n)
+template <typename Work>
+void forEachChunk(long long n, int threads, long long chunk, Work work){
+   auto body = [&](int t){
+      for (long long first = t * chunk; first < n; first += (long long)threads * chunk)
+         work(t, first, std::min(chunk, n - first));
+   };
+   std::vector<std::thread> pool;
+   for (int t = 1; t < threads; t++)
+      pool.emplace_back(body, t);
+   body(0);
+   for (std::thread& th : pool)
+      th.join();
+}
+
+// Min and max of a[0..n-1] (n >= 1) with the given number of threads and chunk size (elements);
+// unlike parallelMinMax() it starts its own threads and gives each one a fixed set of chunks
+inline MinMax chunkedMinMax(const int a[], long long n, int threads, long long chunk){
+   if (threads < 1)
+      threads = 1;
+   if (chunk < 1)
+      chunk = 1;
+   std::vector<Partial> partials(threads);
+   for (Partial& p : partials)
+      p.empty = true;
+   forEachChunk(n, threads, chunk, [&](int t, long long first, long long count){
+      sorting::MinMaxIndex m = sorting::minMaxIndex(a + first, count);
+      MinMax r = { m.min, m.max };
+      Partial& p = partials[t];
+      p.r = p.empty ? r : combine(p.r, r);
+      p.empty = false;
+   });
+   MinMax r = { INT_MAX, INT_MIN };
+   for (const Partial& p : partials)
+      if (!p.empty)
+         r = combine(r, p.r);
+   return r;
+}
+
+class SparseTable{
+   std::vector<std::vector<MinMax>> table; // table[k][i]: a[i..i+2^k-1]
+public:
+   SparseTable(const int a[], int n){
+      table.emplace_back(n);
+      for (int i = 0; i < n; i++)
+         table[0][i] = { a[i], a[i] };
+      for (int k = 1; (1 << k) <= n; k++){
+         int half = 1 << (k - 1);
+         std::vector<MinMax> level(n - (1 << k) + 1);
+         for (int i = 0; i < (int)level.size(); i++)
+            level[i] = combine(table[k - 1][i], table[k - 1][i + half]);
+         table.push_back(std::move(level));
+      }
+   }
+   // Min and max of a[i..j], 0 <= i <= j < n
+   MinMax query(int i, int j) const{
+      int k = 31 - __builtin_clz(j - i + 1);
+      return combine(table[k][i], table[k][j - (1 << k) + 1]);
+   }
+};
+
+class SegmentTree{
+   int n;
+   std::vector<MinMax> tree; // tree[1] is the root, tree[n..2n-1] the leaves
+public:
+   SegmentTree(const int a[], int n) : n(n), tree(2 * n){
+      for (int i = 0; i < n; i++)
+         tree[n + i] = { a[i], a[i] };
+      for (int p = n - 1; p >= 1; p--)
+         tree[p] = combine(tree[2 * p], tree[2 * p + 1]);
+   }
+   // a[i] = value
+   void update(int i, int value){
+      int p = n + i;
+      tree[p] = { value, value };
+      for (p /= 2; p >= 1; p /= 2)
+         tree[p] = combine(tree[2 * p], tree[2 * p + 1]);
+   }
+   // Min and max of a[i..j], 0 <= i <= j < n
+   MinMax query(int i, int j) const{
+      MinMax r = { INT_MAX, INT_MIN };
+      for (int l = i + n, h = j + n + 1; l < h; l /= 2, h /= 2){
+         if (l & 1)
+            r = combine(r, tree[l++]);
+         if (h & 1)
+            r = combine(r, tree[--h]);
+      }
+      return r;
+   }
+};
+
+} // namespace dac
+
+#endif
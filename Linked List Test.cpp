@@ -0,0 +1,321 @@
+/* Linked List (tests)
+Checks the structures of LinkedList.h against a std::vector or std::multiset doing the same operations:
+the pooled and unrolled lists, the LinkedList class, the skip lists, the list sorts, ListArena and compact();
+and the concurrent ones from several threads: LockFreeList, TreiberStack and MPSCQueue.
+Prints each failure and returns 1 if there was any (run by ctest).
+*/
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <thread>
+#include <random>
+#include <algorithm>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+int failures = 0;
+int cases = 0;
+
+void check(bool ok, const char* what){
+   cases++;
+   if (!ok){
+      failures++;
+      cout << "FAILED: " << what << endl;
+   }
+}
+
+vector<int> values(const Node* node){
+   vector<int> out;
+   for (; node != NULL; node = node->next)
+      out.push_back(node->data);
+   return out;
+}
+
+vector<int> values(const UNode* node){
+   vector<int> out;
+   for (; node != NULL; node = node->next)
+      out.insert(out.end(), node->data, node->data + node->count);
+   return out;
+}
+
+// No node is empty or over capacity
+bool validCounts(const UNode* node){
+   for (; node != NULL; node = node->next)
+      if (node->count < 1 || node->count > NODE_CAP)
+         return false;
+   return true;
+}
+
+// NodePool lists and unrolled lists: random pushes, appends, inserts and deletes
+void checkPooledAndUnrolled(mt19937& gen){
+   NodePool pool;
+   Node* head = NULL;
+   UNode* uhead = NULL;
+   vector<int> model, umodel;
+   for (int step = 0; step < 3000; step++){
+      int x = (int)(gen() % 50), op = (int)(gen() % 5);
+      if (op == 0){
+         push(pool, &head, x);
+         model.insert(model.begin(), x);
+         push(&uhead, x);
+         umodel.insert(umodel.begin(), x);
+      } else if (op == 1){
+         append(pool, &head, x);
+         model.push_back(x);
+         append(&uhead, x);
+         umodel.push_back(x);
+      } else if (op == 2 && !model.empty()){
+         int p = (int)(gen() % model.size());
+         Node* prev = head;
+         for (int i = 0; i < p; i++)
+            prev = prev->next;
+         insertAfter(pool, prev, x);
+         model.insert(model.begin() + p + 1, x);
+         UNode* node = uhead;
+         int i = (int)(gen() % umodel.size()), q = i;
+         while (i >= node->count){
+            i -= node->count;
+            node = node->next;
+         }
+         insertAfter(node, i, x);
+         umodel.insert(umodel.begin() + q + 1, x);
+      } else if (op == 3){
+         deleteNode(pool, &head, x);
+         auto it = find(model.begin(), model.end(), x);
+         if (it != model.end())
+            model.erase(it);
+         deleteNode(&uhead, x);
+         auto ut = find(umodel.begin(), umodel.end(), x);
+         if (ut != umodel.end())
+            umodel.erase(ut);
+      } else if (!umodel.empty()){
+         int p = (int)(gen() % umodel.size());
+         deleteNodeAt(&uhead, p);
+         umodel.erase(umodel.begin() + p);
+      }
+   }
+   check(values(head) == model, "NodePool push/append/insertAfter/deleteNode");
+   check(values(uhead) == umodel && validCounts(uhead), "UNode push/append/insertAfter/deleteNode/deleteNodeAt");
+   freeList(uhead);
+}
+
+void checkLinkedList(){
+   LinkedList list;
+   for (int i = 0; i < 10; i++)
+      list.append(i);
+   list.push(-1);
+   list.insertAfter(list.back(), 10);
+   list.deleteNode(5);
+   list.deleteNodeAt(0);
+   LinkedList other;
+   other.append(11);
+   list.splice(other);
+   vector<int> expected = { 0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11 };
+   check(values(list.front()) == expected && list.size() == 11 && list.back()->data == 11 && other.size() == 0,
+         "LinkedList operations");
+   LinkedList moved(std::move(list));
+   check(values(moved.front()) == expected && list.size() == 0 && list.front() == NULL, "LinkedList move");
+   vector<LinkedList> many(1);
+   many[0] = std::move(moved);
+   many.resize(10); // moves the elements, noexcept
+   check(many[0].size() == 11, "LinkedList in a vector");
+}
+
+void checkSkipLists(mt19937& gen){
+   SkipList s;
+   IndexedList l;
+   multiset<int> model;
+   vector<int> seq;
+   for (int step = 0; step < 5000; step++){
+      int x = (int)(gen() % 500);
+      if (gen() % 3 != 0){
+         s.insert(x);
+         model.insert(x);
+      } else {
+         bool present = model.count(x) > 0;
+         check(s.remove(x) == present, "SkipList remove");
+         if (present)
+            model.erase(model.find(x));
+      }
+      int op = (int)(gen() % 4);
+      if (op < 2){
+         int p = (int)(gen() % (seq.size() + 1));
+         l.insertAt(p, x);
+         seq.insert(seq.begin() + p, x);
+      } else if (op == 2 && !seq.empty()){
+         int p = (int)(gen() % seq.size());
+         l.deleteAt(p);
+         seq.erase(seq.begin() + p);
+      } else if (!seq.empty()){
+         int p = (int)(gen() % seq.size());
+         l.set(p, x);
+         seq[p] = x;
+      }
+   }
+   vector<int> inRange, expected;
+   s.range(100, 199, [&](int k){ inRange.push_back(k); });
+   for (auto it = model.lower_bound(100); it != model.end() && *it <= 199; ++it)
+      expected.push_back(*it);
+   check(inRange == expected && s.size() == (int)model.size() && s.search(*model.begin()), "SkipList range/size/search");
+   vector<int> all;
+   l.forEach([&](int v){ all.push_back(v); });
+   bool positions = true;
+   for (int p = 0; p < (int)seq.size(); p += 7)
+      positions = positions && l.get(p) == seq[p];
+   check(all == seq && l.size() == (int)seq.size() && positions, "IndexedList insertAt/deleteAt/get/set");
+}
+
+// Both list sorts are stable: equal keys keep the order of their nodes
+void checkListSorts(mt19937& gen){
+   for (int n : { 0, 1, 2, 3, 100, 1000 }){
+      vector<Node> nodes(n);
+      for (int i = 0; i < n; i++)
+         nodes[i] = { (int)(gen() % 20), (i + 1 < n) ? &nodes[i + 1] : NULL };
+      vector<pair<int, Node*>> expected;
+      for (Node& node : nodes)
+         expected.push_back({ node.data, &node });
+      stable_sort(expected.begin(), expected.end(),
+                  [](const pair<int, Node*>& x, const pair<int, Node*>& y){ return x.first < y.first; });
+      for (int kind = 0; kind < 2; kind++){
+         for (int i = 0; i < n; i++)
+            nodes[i].next = (i + 1 < n) ? &nodes[i + 1] : NULL;
+         Node* head = (n > 0) ? &nodes[0] : NULL;
+         if (kind == 0)
+            mergeSort(&head);
+         else
+            arraySort(&head);
+         bool ok = true;
+         for (int i = 0; i < n; i++, head = head->next)
+            ok = ok && head == expected[i].second;
+         check(ok && head == NULL, kind == 0 ? "mergeSort of a list" : "arraySort of a list");
+      }
+   }
+}
+
+void checkArenaAndCompact(){
+   ListArena arena;
+   int a[] = { 1, 2, 3, 4, 5, 6 }, b[] = { 7, 8 };
+   Node *tail, *tailB;
+   Node* head = arena.buildList(a, 6, &tail);
+   Node* second = arena.buildList(b, 2, &tailB);
+   splice(&head, tail, second, tailB);
+   int removed = arena.deleteIf(&head, [](int d){ return d % 2 == 0; });
+   Node* extra = arena.allocate(9); // reuses a removed node
+   splice(&head, NULL, extra, extra);
+   check(removed == 4 && values(head) == vector<int>({ 9, 1, 3, 5, 7 }), "ListArena buildList/deleteIf/splice");
+
+   Node* list = NULL;
+   for (int i = 5; i >= 1; i--)
+      list = new Node{ i, list };
+   CompactList compacted = compact(list);
+   const Node* front = compacted.front();
+   check(values(front) == vector<int>({ 1, 2, 3, 4, 5 }) && front[4].next == NULL && front[0].next == &front[1],
+         "compact");
+   check(compact(NULL).front() == NULL, "compact of an empty list");
+}
+
+const int THREADS = 4;
+const int PER_THREAD = 20000;
+
+void checkLockFreeList(){
+   LockFreeList list;
+   vector<thread> threads;
+   // Thread t inserts the keys k with k % THREADS == t, then removes the odd ones among them
+   for (int t = 0; t < THREADS; t++)
+      threads.emplace_back([&list, t]{
+         for (int k = t; k < 2000; k += THREADS)
+            list.insert(k);
+         for (int k = t; k < 2000; k += THREADS)
+            if (k % 2 == 1)
+               list.remove(k);
+      });
+   for (thread& th : threads)
+      th.join();
+   vector<int> keys, expected;
+   list.snapshot(keys);
+   for (int k = 0; k < 2000; k += 2)
+      expected.push_back(k);
+   check(keys == expected && list.contains(10) && !list.contains(11) && !list.insert(10), "LockFreeList from threads");
+}
+
+void checkTreiberStack(){
+   TreiberStack stack;
+   vector<AtomicNode> nodes(THREADS * PER_THREAD);
+   vector<thread> threads;
+   for (int t = 0; t < THREADS; t++)
+      threads.emplace_back([&, t]{
+         for (int i = 0; i < PER_THREAD; i++){
+            nodes[t * PER_THREAD + i].data = t * PER_THREAD + i;
+            stack.push(&nodes[t * PER_THREAD + i]);
+         }
+      });
+   // The consumer pops while the producers push
+   vector<bool> seen(nodes.size(), false);
+   int popped = 0;
+   bool ok = true;
+   while (popped < (int)nodes.size() / 2){
+      AtomicNode* node = stack.pop();
+      if (node == NULL)
+         continue;
+      ok = ok && !seen[node->data];
+      seen[node->data] = true;
+      popped++;
+   }
+   for (thread& th : threads)
+      th.join();
+   // The rest as one batch, oldest first: each producer's nodes in the order it pushed them
+   vector<int> last(THREADS, -1);
+   for (AtomicNode* node = reverseList(stack.popAll()); node != NULL; node = node->next.load()){
+      ok = ok && !seen[node->data] && node->data > last[node->data / PER_THREAD];
+      last[node->data / PER_THREAD] = node->data;
+      seen[node->data] = true;
+      popped++;
+   }
+   check(ok && popped == (int)nodes.size() && stack.pop() == NULL, "TreiberStack from threads");
+}
+
+void checkMPSCQueue(){
+   MPSCQueue queue;
+   vector<AtomicNode> nodes(THREADS * PER_THREAD);
+   vector<thread> threads;
+   for (int t = 0; t < THREADS; t++)
+      threads.emplace_back([&, t]{
+         for (int i = 0; i < PER_THREAD; i++){
+            nodes[t * PER_THREAD + i].data = t * PER_THREAD + i;
+            queue.push(&nodes[t * PER_THREAD + i]);
+         }
+      });
+   // Each producer's nodes come out in the order it pushed them
+   vector<int> last(THREADS, -1);
+   int received = 0;
+   bool ok = true;
+   while (received < (int)nodes.size()){
+      AtomicNode* node = queue.pop();
+      if (node == NULL){
+         this_thread::yield();
+         continue;
+      }
+      ok = ok && node->data > last[node->data / PER_THREAD];
+      last[node->data / PER_THREAD] = node->data;
+      received++;
+   }
+   for (thread& th : threads)
+      th.join();
+   check(ok && queue.pop() == NULL, "MPSCQueue from threads");
+}
+
+int main(){
+   mt19937 gen(1);
+   checkPooledAndUnrolled(gen);
+   checkLinkedList();
+   checkSkipLists(gen);
+   checkListSorts(gen);
+   checkArenaAndCompact();
+   checkLockFreeList();
+   checkTreiberStack();
+   checkMPSCQueue();
+   cout << cases << " cases, " << failures << " failures" << endl;
+   return failures == 0 ? 0 : 1;
+}
@@ -37,13 +37,9 @@ Each node in a list consists of at least two parts:
 
 // Single Linked List
 #include <bits/stdc++.h>
+#include "LinkedList.h"
 using namespace std;
-
-class Node{
-   public:
-      int data;
-      Node* next;
-};
+using namespace lists;
 
 // Program to create a simple linked list with 3 nodes
 int main(){
@@ -157,13 +153,9 @@ For traversal, let us write a general-purpose function printList() that prints a
 */
 
 #include <bits/stdc++.h>
+#include "LinkedList.h"
 using namespace std;
-
-class Node{
-   public:
-      int data;
-      Node* next;
-};
+using namespace lists;
 
 // This function prints contents of linked list
 // starting from the given node
@@ -226,87 +218,14 @@ Since a Linked List is typically represented by the head of it, we have to trave
 Time complexity of append is O(n) where n is the number of nodes in linked list.
 Since there is a loop from head to end, the function does O(n) work.
 This method can also be optimized to work in O(1) by keeping an extra pointer to tail of linked list.
+The code is the LinkedList class of LinkedList.h, which keeps that tail pointer, so its append() is O(1);
+push() is a member there and changes the head itself, without a pointer to it.
 */
 
 #include <bits/stdc++.h>
+#include "LinkedList.h"
 using namespace std;
-
-// A linked list node
-class Node{
-    public:
-      int data;
-      Node *next;
-};
-
-/* Given a reference (pointer to pointer)
-to the head of a list and an int, inserts
-a new node on the front of the list. */
-void push(Node** head_ref, int new_data){
-    /* 1. allocate node */
-    Node* new_node = new Node();
-
-    /* 2. put in the data */
-    new_node->data = new_data;
-
-    /* 3. Make next of new node as head */
-    new_node->next = (*head_ref);
-
-    /* 4. move the head to point to the new node */
-    (*head_ref) = new_node;
-}
-
-/* Given a node prev_node, insert a new node after the given
-prev_node */
-void insertAfter(Node* prev_node, int new_data){
-    /*1. check if the given prev_node is NULL */
-    if (prev_node == NULL){
-      cout<<"the given previous node cannot be NULL";
-    return;
-    }
-
-    /* 2. allocate new node */
-    Node* new_node = new Node();
-
-    /* 3. put in the data */
-    new_node->data = new_data;
-
-    /* 4. Make next of new node as next of prev_node */
-    new_node->next = prev_node->next;
-
-    /* 5. move the next of prev_node as new_node */
-    prev_node->next = new_node;
-}
-
-/* Given a reference (pointer to pointer) to the head
-of a list and an int, appends a new node at the end */
-void append(Node** head_ref, int new_data){
-    /* 1. allocate node */
-    Node* new_node = new Node();
-    Node *last = *head_ref; /* used in step 5*/
-
-    /* 2. put in the data */
-    new_node->data = new_data;
-
-    /* 3. This new node is going to be
-    the last node, so make next of
-    it as NULL*/
-    new_node->next = NULL;
-
-    /* 4. If the Linked List is empty,
-    then make the new node as head */
-    if (*head_ref == NULL){
-       *head_ref = new_node;
-       return;
-    }
-
-    /* 5. Else traverse till the last node */
-    while (last->next != NULL)
-        last = last->next;
-
-    /* 6. Change the next of last node */
-    last->next = new_node;
-    return;
-}
+using namespace lists;
 
 // This function prints contents of
 // linked list starting from head
@@ -320,24 +239,24 @@ void printList(Node *node){
 /* Driver code*/
 int main(){
     /* Start with the empty list */
-    Node* head = NULL;
+    LinkedList list;
     // Insert 6. So linked list becomes 6->NULL
-    append(&head, 6);
+    list.append(6);
     // Insert 7 at the beginning.
     // So linked list becomes 7->6->NULL
-    push(&head, 7);
+    list.push(7);
     // Insert 1 at the beginning.
     // So linked list becomes 1->7->6->NULL
-    push(&head, 1);
+    list.push(1);
     // Insert 4 at the end. So
     // linked list becomes 1->7->6->4->NULL
-    append(&head, 4);
+    list.append(4);
     // Insert 8, after 7. So linked
     // list becomes 1->7->8->6->4->NULL
-    insertAfter(head->next, 8);
+    list.insertAfter(list.front()->next, 8);
 
     cout<<"Created Linked list is: ";
-    printList(head);
+    printList(list.front());
     return 0;
 }
 
@@ -351,59 +270,16 @@ To delete a node from linked list, we need to do following steps:
 3) Free memory for the node to be deleted.
 
 Since every node of linked list is dynamically allocated using malloc() in C, we need to call free() for freeing memory allocated for the node to be deleted.
+The code is LinkedList::deleteNode() in LinkedList.h, which allocates with new and frees with delete.
 */
 
 #include <stdio.h>
-#include <stdlib.h>
-
-// A linked list node
-struct Node{
-    int data;
-    struct Node *next;
-};
-
-/* Given a reference (pointer to pointer) to the head of a list
-   and an int, inserts a new node on the front of the list. */
-void push(struct Node** head_ref, int new_data){
-    struct Node* new_node = (struct Node*) malloc(sizeof(struct Node));
-    new_node->data  = new_data;
-    new_node->next = (*head_ref);
-    (*head_ref)    = new_node;
-}
-
-/* Given a reference (pointer to pointer) to the head of a list
-   and a key, deletes the first occurrence of key in linked list */
-void deleteNode(struct Node **head_ref, int key){
-    // Store head node
-    struct Node* temp = *head_ref, *prev;
-
-    // If head node itself holds the key to be deleted
-    if (temp != NULL && temp->data == key)
-    {
-        *head_ref = temp->next;   // Changed head
-        free(temp);               // free old head
-        return;
-    }
-
-    // Search for the key to be deleted, keep track of the
-    // previous node as we need to change 'prev->next'
-    while (temp != NULL && temp->data != key){
-        prev = temp;
-        temp = temp->next;
-    }
-
-    // If key was not present in linked list
-    if (temp == NULL) return;
-
-    // Unlink the node from linked list
-    prev->next = temp->next;
-
-    free(temp);  // Free memory
-}
+#include "LinkedList.h"
+using namespace lists;
 
 // This function prints contents of linked list starting from
 // the given node
-void printList(struct Node *node){
+void printList(Node *node){
     while (node != NULL){
        printf(" %d ", node->data);
        node = node->next;
@@ -413,18 +289,18 @@ void printList(struct Node *node){
 /* Drier program to test above functions*/
 int main(){
     /* Start with the empty list */
-    struct Node* head = NULL;
+    LinkedList list;
 
-    push(&head, 7);
-    push(&head, 1);
-    push(&head, 3);
-    push(&head, 2);
+    list.push(7);
+    list.push(1);
+    list.push(3);
+    list.push(2);
 
     puts("Created Linked List: ");
-    printList(head);
-    deleteNode(&head, 1);
+    printList(list.front());
+    list.deleteNode(1);
     puts("\nLinked List after Deletion of 1: ");
-    printList(head);
+    printList(list.front());
     return 0;
 }
 
@@ -441,86 +317,970 @@ Output: Linked List = 2->3->1->7
 If the node to be deleted is the root, simply delete it.
 To delete a middle node, we must have a pointer to the node previous to the node to be deleted.
 So if positions are not zero, we run a loop position-1 times and get a pointer to the previous node.
+The code is LinkedList::deleteNodeAt(), which also returns if the position is negative.
 */
 
 #include <stdio.h>
-#include <stdlib.h>
+#include "LinkedList.h"
+using namespace lists;
+
+// This function prints contents of linked list starting from
+// the given node
+void printList(Node *node){
+    while (node != NULL)
+    {
+        printf(" %d ", node->data);
+        node = node->next;
+    }
+}
+
+/* Driver program to test above functions*/
+int main(){
+    /* Start with the empty list */
+    LinkedList list;
+
+    list.push(7);
+    list.push(1);
+    list.push(3);
+    list.push(2);
+    list.push(8);
+
+    puts("Created Linked List: ");
+    printList(list.front());
+    list.deleteNodeAt(4);
+    puts("\nLinked List after Deletion at position 4: ");
+    printList(list.front());
+    return 0;
+}
+
+
+/* Node Pool
+push(), insertAfter() and append() call new once per element and deleteNode() calls delete once per element.
+In list-heavy code these allocator calls cost more than the list operations themselves,
+and the nodes end up scattered over the heap, so a traversal misses the cache on every node.
+
+A node pool allocates Nodes in large contiguous chunks and hands them out one at a time:
+1. allocate(): take the first node of the free list; if it is empty, carve the next node out of the current chunk
+   (allocating a new chunk of CHUNK nodes when the current one is used up).
+2. release(node): put the node at the front of the free list. The free list is intrusive:
+   it is linked through the node's own next pointer, so it needs no extra memory.
+3. releaseList(head): give back a whole list by linking its last node to the free list, one traversal and no allocator calls.
+4. Destroying the pool (or reset()) frees every chunk at once.
+
+Nodes allocated one after another sit next to each other in memory, so a list built with the pool
+is traversed with far fewer cache misses.
+
+Time Complexity:
+allocate(), release(): O(1)
+releaseList(): O(n) pointer walk to find the tail, O(1) if the tail is known
+*/
 
-// A linked list node
-struct Node{
-    int data;
-    struct Node *next;
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+// This function prints contents of
+// linked list starting from head
+void printList(Node *node){
+   while (node != NULL){
+      cout<<" "<<node->data;
+      node = node->next;
+   }
+}
+
+// Sums the list, to time a traversal
+long long sumList(Node *node){
+   long long sum = 0;
+   for (; node != NULL; node = node->next)
+      sum += node->data;
+   return sum;
+}
+
+/* Driver code*/
+int main(){
+    NodePool pool;
+    Node* head = NULL;
+    append(pool, &head, 6);
+    push(pool, &head, 7);
+    push(pool, &head, 1);
+    append(pool, &head, 4);
+    insertAfter(pool, head->next, 8);
+    cout<<"Created Linked list is: ";
+    printList(head);
+    deleteNode(pool, &head, 8);
+    cout<<"\nLinked list after deletion of 8: ";
+    printList(head);
+    pool.releaseList(head);
+
+    // new/delete per node against the pool, one million pushes and one traversal each
+    const int N = 1000000;
+    auto start = chrono::steady_clock::now();
+    Node* heapList = NULL;
+    for (int i = 0; i < N; i++){
+        Node* node = new Node();
+        node->data = i;
+        node->next = heapList;
+        heapList = node;
+    }
+    long long s1 = sumList(heapList);
+    while (heapList != NULL){
+        Node* next = heapList->next;
+        delete heapList;
+        heapList = next;
+    }
+    auto mid = chrono::steady_clock::now();
+    Node* poolList = NULL;
+    for (int i = 0; i < N; i++)
+        push(pool, &poolList, i);
+    long long s2 = sumList(poolList);
+    pool.releaseList(poolList);
+    auto end = chrono::steady_clock::now();
+    cout << "\nnew/delete: " << chrono::duration<double, milli>(mid - start).count() << " ms"
+         << ", pool: " << chrono::duration<double, milli>(end - mid).count() << " ms"
+         << (s1 == s2 ? "" : " (sums differ!)") << endl;
+    return 0;
+}
+
+
+/* Unrolled Linked List
+In the Node class above every int carries an 8-byte pointer (16 bytes per element with padding),
+and every element of a traversal is a separate memory access, usually a cache miss.
+
+An unrolled linked list stores a small array of elements in each node:
+   +------+-------+-------------------------------+
+   | next | count | data[0] data[1] ... data[12]  |   one 64-byte cache line
+   +------+-------+-------------------------------+
+A traversal reads 13 ints per pointer dereference, and for int payloads the list needs
+between 5 (nodes full) and 10 (nodes half full) bytes per element.
+
+Operations (same as for the simple list):
+push(): insert at the front of the first node, a new node only if it is full.
+insertAfter(node, i, x): insert x after element i of node. If the node is full it is split into two half-full nodes.
+append(): add at the end of the last node (the walk to the tail is n/13 nodes).
+deleteNode(key) and deleteNodeAt(position): remove the element by shifting the rest of its node;
+a node that becomes less than half full takes elements from (or merges with) its successor,
+so deletions do not leave the list full of nearly empty nodes.
+
+Time Complexity:
+push(), insertAfter(): O(1) (at most one node of 13 elements is shifted)
+append(), delete by key or position: O(n / 13) node visits
+*/
+
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+// This function prints contents of
+// linked list starting from head
+void printList(UNode* node){
+   for (; node != NULL; node = node->next)
+      for (int i = 0; i < node->count; i++)
+         cout<<" "<<node->data[i];
+}
+
+/* Driver code*/
+int main(){
+    UNode* head = NULL;
+    for (int i = 1; i <= 20; i++)
+        append(&head, i);
+    push(&head, 0);
+    insertAfter(head->next, 2, 100);
+    cout<<"Created Linked list is: ";
+    printList(head);
+    deleteNode(&head, 100);
+    deleteNodeAt(&head, 0);
+    deleteNodeAt(&head, 12);
+    cout<<"\nAfter deleting 100 and the elements at positions 0 and 12: ";
+    printList(head);
+    freeList(head);
+
+    // Traversal of one million ints: one int per node against 13 per node
+    const int N = 1000000;
+    struct Node { int data; Node* next; };
+    Node* simple = NULL;
+    UNode* unrolled = NULL;
+    for (int i = N - 1; i >= 0; i--){
+        simple = new Node{ i, simple };
+        push(&unrolled, i);
+    }
+    auto t0 = chrono::steady_clock::now();
+    long long s1 = 0;
+    for (Node* n = simple; n != NULL; n = n->next)
+        s1 += n->data;
+    auto t1 = chrono::steady_clock::now();
+    long long s2 = 0;
+    for (UNode* n = unrolled; n != NULL; n = n->next)
+        for (int i = 0; i < n->count; i++)
+            s2 += n->data[i];
+    auto t2 = chrono::steady_clock::now();
+    cout << "\nNode: " << chrono::duration<double, milli>(t1 - t0).count() << " ms, "
+         << "unrolled: " << chrono::duration<double, milli>(t2 - t1).count() << " ms"
+         << (s1 == s2 ? "" : " (sums differ!)") << endl;
+    while (simple != NULL){
+        Node* next = simple->next;
+        delete simple;
+        simple = next;
+    }
+    freeList(unrolled);
+    return 0;
+}
+
+
+/* Linked List class with a tail pointer
+append() above walks the whole list to find the last node, so building a list of n elements by appending is O(n^2).
+The functions also never free the nodes they allocate.
+
+The LinkedList class owns its nodes and keeps three fields:
+head - the first node, as before
+tail - the last node, so append() links the new node directly: O(1)
+size - the number of nodes, so size() is O(1)
+
+Every operation that can change the last node (append, insertAfter the tail, deleting the tail) updates tail.
+The destructor frees all nodes (RAII), so a list cannot leak.
+A list cannot be copied by accident, but it can be moved: moving hands over the three fields,
+so a list can be returned from a function or spliced onto another list without touching its nodes.
+
+Time Complexity:
+push(), append(), insertAfter(), size(), splice(), move: O(1)
+deleteNode() by key or position: O(n)
+*/
+
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+// This function prints contents of
+// linked list starting from head
+void printList(const LinkedList& list){
+   for (Node* node = list.front(); node != NULL; node = node->next)
+      cout<<" "<<node->data;
+}
+
+// Returned by moving, no node is copied
+LinkedList range(int from, int to){
+    LinkedList list;
+    for (int i = from; i < to; i++)
+        list.append(i);
+    return list;
+}
+
+/* Driver code*/
+int main(){
+    LinkedList list;
+    list.append(6);
+    list.push(7);
+    list.push(1);
+    list.append(4);
+    list.insertAfter(list.front()->next, 8);
+    cout<<"Created Linked list is: ";
+    printList(list);
+    list.deleteNode(4);
+    list.deleteNodeAt(0);
+    cout<<"\nAfter deleting 4 and position 0: ";
+    printList(list);
+
+    LinkedList more = range(10, 13);
+    list.splice(more);
+    list.append(99);
+    cout<<"\nAfter splicing 10..12 and appending 99: ";
+    printList(list);
+    cout<<"\nSize: "<<list.size()<<", spliced list size: "<<more.size();
+
+    // A million appends, each O(1)
+    LinkedList big = range(0, 1000000);
+    cout<<"\nBig list size: "<<big.size()<<", last: "<<big.back()->data<<endl;
+    return 0;
+}
+
+
+/* Lock-free Sorted Linked List
+push() and deleteNode() above are not safe to call from several threads at once, and protecting them with one mutex
+makes every thread wait for every other. This list (Harris' algorithm, with epoch-based memory reclamation)
+lets any number of threads search, insert and delete at the same time without locks.
+
+Ideas:
+1. The list is kept sorted, so a key has exactly one place and every operation first finds (prev, cur)
+   with prev->key < key <= cur->key.
+2. Insert links the new node with one compare-and-swap (CAS) on prev->next: it succeeds only if prev->next
+   is still cur, otherwise another thread changed that spot and the search is retried.
+3. Delete is done in two steps. First the node is marked deleted by setting the lowest bit of its own next pointer
+   (logical delete); from then on no thread can link a node after it. Then it is unlinked with a CAS on prev->next
+   (physical delete). Any thread that walks over a marked node helps to unlink it.
+4. An unlinked node may still be read by threads that were walking the list when it was removed,
+   so it cannot be freed at once. Epoch-based reclamation:
+   - a global epoch counter; every operation announces the epoch it started in and clears it when done;
+   - an unlinked node is retired together with the current epoch;
+   - the epoch moves on only when every active thread has announced the current one,
+     so two epochs later no thread can still hold the node and it is freed.
+   Readers pay one announcement per operation instead of one per node (as hazard pointers would),
+   and a thread that sleeps inside an operation only delays freeing, never the other threads.
+   The announcements are kept in a list of records that grows by one CAS when a new thread needs one;
+   a thread that exits frees its record for the next thread, so any number of threads can use the list.
+
+Time Complexity:
+insert(), remove(), contains(): O(n) per operation, as for the simple list, but operations of different threads
+proceed in parallel and a stalled thread never blocks the others.
+*/
+
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+// For comparison: the simple sorted list behind one global mutex
+class MutexList{
+    Node* head = NULL;
+    mutex lock;
+public:
+    ~MutexList(){
+        while (head != NULL){
+            Node* next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+    bool insert(int key){
+        lock_guard<mutex> guard(lock);
+        Node** p = &head;
+        while (*p != NULL && (*p)->data < key)
+            p = &(*p)->next;
+        if (*p != NULL && (*p)->data == key)
+            return false;
+        *p = new Node{ key, *p };
+        return true;
+    }
+    bool remove(int key){
+        lock_guard<mutex> guard(lock);
+        Node** p = &head;
+        while (*p != NULL && (*p)->data < key)
+            p = &(*p)->next;
+        if (*p == NULL || (*p)->data != key)
+            return false;
+        Node* temp = *p;
+        *p = temp->next;
+        delete temp;
+        return true;
+    }
+    bool contains(int key){
+        lock_guard<mutex> guard(lock);
+        Node* n = head;
+        while (n != NULL && n->data < key)
+            n = n->next;
+        return n != NULL && n->data == key;
+    }
 };
 
-/* Given a reference (pointer to pointer) to the head of a list
-   and an int inserts a new node on the front of the list. */
-void push(struct Node** head_ref, int new_data){
-    struct Node* new_node = (struct Node*) malloc(sizeof(struct Node));
-    new_node->data  = new_data;
-    new_node->next = (*head_ref);
-    (*head_ref)    = new_node;
-}
-
-/* Given a reference (pointer to pointer) to the head of a list
-   and a position, deletes the node at the given position */
-void deleteNode(struct Node **head_ref, int position){
-   // If linked list is empty
-   if (*head_ref == NULL)
-      return;
-
-   // Store head node
-   struct Node* temp = *head_ref;
-
-    // If head needs to be removed
-    if (position == 0){
-        *head_ref = temp->next;   // Change head
-        free(temp);               // free old head
-        return;
+// Each thread does ops random operations on keys 0..range-1: 80% lookups, 10% inserts, 10% removes
+template <typename List>
+double run(List& list, int threads, int ops, int range){
+    atomic<long> hits(0); // keeps the compiler from dropping lookups whose result is unused
+    auto start = chrono::steady_clock::now();
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++)
+        pool.emplace_back([&list, &hits, t, ops, range](){
+            mt19937 gen(t + 1);
+            long found = 0;
+            for (int i = 0; i < ops; i++){
+                int key = gen() % range, op = gen() % 10;
+                if (op == 0)
+                    found += list.insert(key);
+                else if (op == 1)
+                    found += list.remove(key);
+                else
+                    found += list.contains(key);
+            }
+            hits += found;
+        });
+    for (auto& th : pool)
+        th.join();
+    double s = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return threads * (double)ops / s / 1e6;
+}
+
+/* Driver code*/
+int main(){
+    LockFreeList list;
+    // Four threads insert disjoint keys, then remove the odd ones
+    vector<thread> pool;
+    for (int t = 0; t < 4; t++)
+        pool.emplace_back([&list, t](){
+            for (int k = t; k < 40; k += 4)
+                list.insert(k);
+            for (int k = t; k < 40; k += 4)
+                if (k % 2 == 1)
+                    list.remove(k);
+        });
+    for (auto& th : pool)
+        th.join();
+    vector<int> keys;
+    list.snapshot(keys);
+    cout << "List after concurrent inserts and removes:";
+    for (int k : keys)
+        cout << " " << k;
+    cout << "\nContains 10: " << list.contains(10) << ", contains 11: " << list.contains(11) << "\n";
+
+    // Throughput in millions of operations per second
+    int threads = max(2u, thread::hardware_concurrency());
+    LockFreeList lf;
+    MutexList ml;
+    for (int k = 0; k < 512; k += 2){
+        lf.insert(k);
+        ml.insert(k);
     }
+    cout << "threads,lock_free_mops,mutex_mops\n";
+    for (int t = 1; t <= threads; t *= 2)
+        cout << t << "," << run(lf, t, 200000, 512) << "," << run(ml, t, 200000, 512) << "\n";
+    return 0;
+}
 
-    // Find previous node of the node to be deleted
-    for (int i=0; temp!=NULL && i<position-1; i++)
-         temp = temp->next;
 
-    // If position is more than number of nodes
-    if (temp == NULL || temp->next == NULL)
-         return;
+/* Lock-free Stack and Queue for many producers
+push() above is a stack push: the new node becomes the head. When many threads feed work into one list,
+that push can be made lock-free, so producers never wait on a mutex.
+
+Treiber stack:
+push(node): read head, set node->next = head, compare-and-swap (CAS) head from that value to node;
+            if another thread pushed first the CAS fails and push retries with the new head.
+popAll():   exchange head with NULL in one atomic step and take the whole list at once.
+            The consumer then works on a private list: one atomic operation per batch instead of per node.
+pop():      read head, CAS head from it to head->next.
+            ABA problem: if between the read and the CAS the head node were removed (by pop() or popAll())
+            and pushed again, the CAS would succeed with a stale next pointer and lose or resurrect nodes.
+            Only removals can cause this, so pop() and popAll() are both for one consumer thread:
+            with a single remover the head seen by pop() can only gain nodes above it, never be removed and reused.
+            Several consumers would need a generation counter next to head (double-width CAS) or hazard pointers.
+
+MPSC queue (Dmitry Vyukov's intrusive queue), for when the consumer needs first-in first-out order:
+push(node): node->next = NULL; prev = exchange(head, node); prev->next = node.
+            One atomic exchange, no retry loop, so producers never spin.
+pop():      the single consumer follows next pointers from its tail; a permanent stub node keeps the
+            queue non-empty so head and tail never have to be updated together.
+            Between a producer's exchange and its link, pop() may briefly see the queue as empty.
+
+Nodes are intrusive: they have the same shape as the list Node (data and next),
+so the caller allocates them and can recycle them, and the queue itself never allocates.
+
+Time Complexity:
+push(), pop(), popAll(): O(1)
+*/
 
-    // Node temp->next is the node to be deleted
-    // Store pointer to the next of node to be deleted
-    struct Node *next = temp->next->next;
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+// For comparison: a list behind a mutex, the structure this replaces
+struct MutexStack{
+    mutex lock;
+    AtomicNode* head = NULL;
+    void push(AtomicNode* node){
+        lock_guard<mutex> guard(lock);
+        node->next.store(head, memory_order_relaxed);
+        head = node;
+    }
+    AtomicNode* popAll(){
+        lock_guard<mutex> guard(lock);
+        AtomicNode* all = head;
+        head = NULL;
+        return all;
+    }
+};
 
-    // Unlink the node from linked list
-    free(temp->next);  // Free memory
+// producers threads push perProducer nodes each, one consumer drains with popAll; returns Mops/s
+template <typename Stack>
+double feed(Stack& stack, int producers, int perProducer, long long& sum){
+    vector<AtomicNode> nodes((size_t)producers * perProducer);
+    long long expected = (long long)producers * perProducer;
+    auto start = chrono::steady_clock::now();
+    vector<thread> pool;
+    for (int p = 0; p < producers; p++)
+        pool.emplace_back([&, p](){
+            for (int i = 0; i < perProducer; i++){
+                AtomicNode* node = &nodes[(size_t)p * perProducer + i];
+                node->data = i;
+                stack.push(node);
+            }
+        });
+    sum = 0;
+    for (long long got = 0; got < expected; ){
+        AtomicNode* batch = stack.popAll();
+        if (batch == NULL)
+            this_thread::yield();
+        for (; batch != NULL; batch = batch->next.load(memory_order_relaxed)){
+            sum += batch->data;
+            got++;
+        }
+    }
+    for (auto& th : pool)
+        th.join();
+    double s = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return expected / s / 1e6;
+}
 
-    temp->next = next;  // Unlink the deleted node from list
+/* Driver code*/
+int main(){
+    TreiberStack stack;
+    AtomicNode a(1), b(7), c(8);
+    stack.push(&a);
+    stack.push(&b);
+    stack.push(&c);
+    cout << "pop(): " << stack.pop()->data << ", popAll() oldest first:";
+    for (AtomicNode* n = reverseList(stack.popAll()); n != NULL; n = n->next.load())
+        cout << " " << n->data;
+
+    // Four producers, one consumer: every producer's items must come out in its own order
+    MPSCQueue queue;
+    const int PER = 100000;
+    vector<AtomicNode> items(4 * PER);
+    vector<thread> producers;
+    for (int p = 0; p < 4; p++)
+        producers.emplace_back([&queue, &items, p](){
+            for (int i = 0; i < PER; i++){
+                AtomicNode* node = &items[p * PER + i];
+                node->data = p * PER + i;
+                queue.push(node);
+            }
+        });
+    int last[4] = { -1, -1, -1, -1 }, received = 0;
+    bool ordered = true;
+    while (received < 4 * PER){
+        AtomicNode* node = queue.pop();
+        if (node == NULL){
+            this_thread::yield();
+            continue;
+        }
+        int p = node->data / PER;
+        ordered = ordered && node->data > last[p];
+        last[p] = node->data;
+        received++;
+    }
+    for (auto& th : producers)
+        th.join();
+    cout << "\nMPSC queue received " << received << " items, per-producer order kept: " << ordered;
+
+    // Producers feeding one consumer through popAll(), lock-free against mutex
+    long long s1, s2;
+    TreiberStack lockFree;
+    MutexStack locked;
+    double m1 = feed(lockFree, 4, 250000, s1);
+    double m2 = feed(locked, 4, 250000, s2);
+    cout << "\nTreiber stack: " << m1 << " Mops/s, mutex list: " << m2 << " Mops/s"
+         << (s1 == s2 ? "" : " (sums differ!)") << endl;
+    return 0;
 }
 
-// This function prints contents of linked list starting from
-// the given node
-void printList(struct Node *node){
-    while (node != NULL)
-    {
-        printf(" %d ", node->data);
-        node = node->next;
+
+/* Skip List
+deleteNode() and any search on a sorted linked list walk the nodes one by one: O(n) per operation.
+A skip list adds "express lanes" on top of the sorted list:
+level 0 links every node, level 1 about every 2nd node, level 2 about every 4th, and so on.
+
+   level 2: head -----------------------> 30 ---------------------------> NULL
+   level 1: head --------> 12 ----------> 30 ----------> 55 ------------> NULL
+   level 0: head -> 5 ---> 12 -> 19 ----> 30 -> 41 ----> 55 -> 60 ------> NULL
+
+Search: start at the highest level of head, move right while the next key is smaller than the key,
+then drop one level. At level 0 the next node is the first one >= key.
+Insert: do the search while remembering the last node visited on every level (update[]),
+draw the new node's height (height h with probability 1/2^h) and link it after update[i] on each of its levels.
+Delete: the same search, then unlink the node on every level where update[i]->next[i] is the node.
+Range iteration: search for the lower bound, then follow level 0.
+
+Nodes have a variable number of next pointers, so they are carved from large chunks by a small pool
+with one free list per height, which also keeps nodes close together in memory.
+
+Time Complexity (expected):
+search(), insert(), remove(): O(log(n))
+range(lo, hi): O(log(n) + number of keys in the range)
+*/
+
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+/* Driver code*/
+int main(){
+    SkipList list;
+    int keys[] = { 30, 5, 55, 12, 41, 19, 60 };
+    for (int k : keys)
+        list.insert(k);
+    list.remove(41);
+    cout << "Keys in [10, 56]:";
+    list.range(10, 56, [](int k){ cout << " " << k; });
+    cout << "\nSearch 19: " << list.search(19) << ", search 41: " << list.search(41) << "\n";
+
+    // Delete random keys from a sorted list of N keys: linear deleteNode against the skip list
+    const int N = 200000, DELETES = 2000;
+    LinkedList linear;
+    SkipList skip;
+    for (int i = N - 1; i >= 0; i--){
+        linear.push(2 * i);
+        skip.insert(2 * i);
     }
+    mt19937 gen(1);
+    vector<int> victims(DELETES);
+    for (int& v : victims)
+        v = 2 * (int)(gen() % N);
+    auto t0 = chrono::steady_clock::now();
+    for (int v : victims)
+        linear.deleteNode(v);
+    auto t1 = chrono::steady_clock::now();
+    for (int v : victims)
+        skip.remove(v);
+    auto t2 = chrono::steady_clock::now();
+    cout << DELETES << " deletes from " << N << " keys: linear deleteNode "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms, skip list "
+         << chrono::duration<double, milli>(t2 - t1).count() << " ms\n";
+    return 0;
 }
 
-/* Driver program to test above functions*/
+
+/* Merge Sort for Linked Lists
+A linked list cannot be indexed, so quick sort and heap sort do not fit, but merge sort does:
+merging two sorted lists only relinks nodes, it needs no extra array.
+
+Bottom-up (no recursion, O(1) extra space):
+runs[i] holds a sorted run of 2^i nodes (or is empty), like the bits of a binary counter.
+1. Take the nodes off the list one at a time; each one is a sorted run of length 1 (carry).
+2. While runs[i] is not empty: carry = merge(runs[i], carry), runs[i] = empty, i++. Then runs[i] = carry.
+3. At the end merge all remaining runs, smallest first.
+64 slots are enough for any list that fits in memory. Earlier nodes are always in the left run and ties take
+the left node, so the sort is stable.
+
+Copy to array, sort, relink:
+Every merge step follows next pointers, and on a big list whose nodes are scattered over memory each step is a cache miss.
+For such lists it is faster to copy (key, node) pairs into an array in one pass, sort the array
+(contiguous, cache friendly), and relink the nodes in sorted order in a second pass.
+This uses O(n) extra memory.
+
+The driver sorts a list of nodes allocated in random order with both methods (pass n as the first argument, e.g. 10000000).
+
+Time Complexity:
+Best: Ω(n log(n))
+Average: θ(n log(n))
+Worst: O(n log(n))
+*/
+
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+// This function prints contents of
+// linked list starting from head
+void printList(Node *node){
+   while (node != NULL){
+      cout<<" "<<node->data;
+      node = node->next;
+   }
+}
+
+// Links the nodes of pool in a random order with random keys, like a list built over time
+Node* scatteredList(vector<Node>& pool, unsigned seed){
+    mt19937 gen(seed);
+    vector<int> order(pool.size());
+    iota(order.begin(), order.end(), 0);
+    shuffle(order.begin(), order.end(), gen);
+    Node* head = NULL;
+    for (int i : order){
+        pool[i].data = (int)(gen() % 1000000000);
+        pool[i].next = head;
+        head = &pool[i];
+    }
+    return head;
+}
+
+bool isSorted(Node* n){
+    for (; n != NULL && n->next != NULL; n = n->next)
+        if (n->next->data < n->data)
+            return false;
+    return true;
+}
+
+/* Driver code*/
+int main(int argc, char** argv){
+    NodePool nodes;
+    Node* head = NULL;
+    int keys[] = { 15, 10, 5, 20, 3, 2, 10 };
+    for (int k : keys)
+        push(nodes, &head, k);
+    cout << "Linked list:";
+    printList(head);
+    mergeSort(&head);
+    cout << "\nSorted:";
+    printList(head);
+
+    size_t n = (argc > 1) ? strtoull(argv[1], NULL, 10) : 1000000;
+    vector<Node> pool(n);
+    Node* list = scatteredList(pool, 1);
+    auto t0 = chrono::steady_clock::now();
+    mergeSort(&list);
+    auto t1 = chrono::steady_clock::now();
+    bool ok1 = isSorted(list);
+    list = scatteredList(pool, 1);
+    auto t2 = chrono::steady_clock::now();
+    arraySort(&list);
+    auto t3 = chrono::steady_clock::now();
+    bool ok2 = isSorted(list);
+    cout << "\n" << n << " scattered nodes: bottom-up merge sort "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms, array sort + relink "
+         << chrono::duration<double, milli>(t3 - t2).count() << " ms"
+         << (ok1 && ok2 ? "" : " (not sorted!)") << endl;
+    return 0;
+}
+
+
+/* Indexable Skip List (positional access)
+LinkedList::deleteNodeAt() walks position-1 nodes, so deleting by position in a loop is O(n^2).
+A skip list whose links also store their width (how many level-0 steps they jump over)
+can find the node at any position in O(log(n)) by skipping whole spans.
+
+   level 1: head ---------3---------> 30 ----------2----------> 55 --2--> NULL
+   level 0: head -1-> 5 -1-> 12 -1-> 30 -1-> 41 -1-> 55 -1-> 60 -1-> NULL
+   positions:         0      1       2       3       4       5
+
+Find position p: start at the top level of head with traversed = 0 and move along a link
+while traversed + width <= p; then drop a level. At level 0 the current node is at step p (head is step 0),
+i.e. it is the predecessor of position p. update[i] remembers the last node on every level, rank[i] its step.
+Insert at p: link the new node after update[i] on each of its levels, split the width of update[i]'s link
+between the two, and add 1 to the widths of the links above the new node's height that jump over it.
+Delete at p: unlink the node where update[i] points to it (merging the two widths), subtract 1 elsewhere.
+A link to NULL keeps the width to a virtual node after the last element, so the formulas need no special cases.
+
+The list keeps the elements in their insertion order (it is not sorted), like the simple list,
+and level 0 is a plain linked list for iteration.
+
+Time Complexity (expected):
+get(p), set(p), insertAt(p), deleteAt(p): O(log(n))
+iteration: O(n)
+*/
+
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+/* Driver code*/
 int main(){
-    /* Start with the empty list */
-    struct Node* head = NULL;
+    IndexedList list;
+    int values[] = { 8, 2, 3, 1, 7 };
+    for (int v : values)
+        list.append(v);
+    list.deleteAt(1);
+    list.insertAt(2, 42);
+    cout << "List after deleting position 1 and inserting 42 at position 2:";
+    list.forEach([](int v){ cout << " " << v; });
+    cout << "\nElement at position 3: " << list.get(3) << "\n";
+
+    // Delete at random positions: walking deleteNodeAt against the indexed list
+    const int N = 200000, DELETES = 1000;
+    LinkedList linear;
+    IndexedList indexed;
+    for (int i = N - 1; i >= 0; i--){
+        linear.push(i);
+        indexed.push(i);
+    }
+    mt19937 gen(1);
+    vector<int> positions(DELETES);
+    for (int d = 0; d < DELETES; d++)
+        positions[d] = gen() % (N - d);
+    auto t0 = chrono::steady_clock::now();
+    for (int p : positions)
+        linear.deleteNodeAt(p);
+    auto t1 = chrono::steady_clock::now();
+    for (int p : positions)
+        indexed.deleteAt(p);
+    auto t2 = chrono::steady_clock::now();
+    bool same = true;
+    Node* n = linear.front();
+    indexed.forEach([&](int v){ same = same && n != NULL && n->data == v; if (n != NULL) n = n->next; });
+    cout << DELETES << " deletes by position from " << N << ": deleteNodeAt "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms, indexed list "
+         << chrono::duration<double, milli>(t2 - t1).count() << " ms"
+         << (same ? "" : " (lists differ!)") << endl;
+    return 0;
+}
 
-    push(&head, 7);
-    push(&head, 1);
-    push(&head, 3);
-    push(&head, 2);
-    push(&head, 8);
 
-    puts("Created Linked List: ");
+/* Batch Operations
+Calling push(), append() or deleteNode() once per element costs an allocation (and for append and deleteNode a traversal)
+every time, even when thousands of elements are ready at once. Batch versions do the work once for the whole batch:
+
+buildList(arr, n): one allocation of n nodes in a single block, linked in one pass in array order.
+                   The nodes are contiguous, so the new list is also fast to traverse.
+deleteIf(pred):    one traversal with a pointer to the link being examined (Node**),
+                   so the head needs no special case; every matching node is unlinked with a single store.
+splice(prev, first, last): links the chain first..last after prev with two stores, O(1), independent of the lengths.
+
+Because buildList() allocates a block, single nodes cannot be given back with delete.
+A ListArena owns the blocks: removed nodes go on its free list (reused by allocate())
+and everything is freed when the arena is destroyed.
+
+Time Complexity:
+buildList(): O(n) with 1 allocation
+deleteIf(): O(n), one traversal
+splice(): O(1)
+*/
+
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+// This function prints contents of
+// linked list starting from head
+void printList(Node *node){
+   while (node != NULL){
+      cout<<" "<<node->data;
+      node = node->next;
+   }
+}
+
+/* Driver code*/
+int main(){
+    ListArena arena;
+    int values[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    Node* tail;
+    Node* head = arena.buildList(values, 8, &tail);
+    cout << "Built list:";
     printList(head);
-    deleteNode(&head, 4);
-    puts("\nLinked List after Deletion at position 4: ");
+
+    int removed = arena.deleteIf(&head, [](int v){ return v % 3 == 0; });
+    cout << "\nAfter deleting " << removed << " multiples of 3:";
     printList(head);
+
+    int more[] = { 100, 200, 300 };
+    Node* moreTail;
+    Node* moreHead = arena.buildList(more, 3, &moreTail);
+    splice(&head, head->next, moreHead, moreTail);
+    cout << "\nAfter splicing 100 200 300 after the second node:";
+    printList(head);
+
+    // Building and filtering a million elements: per element against batch
+    const int N = 1000000;
+    vector<int> data(N);
+    iota(data.begin(), data.end(), 0);
+    auto t0 = chrono::steady_clock::now();
+    Node* single = NULL;
+    Node** end = &single;
+    for (int i = 0; i < N; i++){
+        *end = new Node{ data[i], NULL };
+        end = &(*end)->next;
+    }
+    for (int k = 0; k < N / 2; k++){
+        // deleteNode(&single, k): the key is always at the head here, the best case for it
+        Node* temp = single;
+        single = temp->next;
+        delete temp;
+    }
+    auto t1 = chrono::steady_clock::now();
+    Node* batch = arena.buildList(data.data(), N, NULL);
+    arena.deleteIf(&batch, [](int v){ return v < N / 2; });
+    auto t2 = chrono::steady_clock::now();
+    cout << "\nBuild + delete half of " << N << ": one node at a time "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms, batch "
+         << chrono::duration<double, milli>(t2 - t1).count() << " ms" << endl;
+    while (single != NULL){
+        Node* next = single->next;
+        delete single;
+        single = next;
+    }
     return 0;
 }
+
+
+/* Compaction (instead of prefetching)
+printList() and every other full traversal load node->next before they know where the next node is,
+so when the nodes are scattered in memory each step waits for a cache miss (about 100 ns).
+
+Why not prefetch:
+A software prefetch only helps if the address of a node is known before the chain reaches it.
+Running a second pointer a few nodes ahead does not give that: it has to follow the same next pointers,
+so it waits for the same misses (measured, it was slower than the plain loop).
+Recording the addresses in an array first does give them, but costs O(n) memory, goes stale after any insert
+or delete, and measured no faster with the prefetch than without it (the processor already overlaps the misses
+of a loop over an array of addresses). Nodes from a NodePool or a ListArena are allocated in chunks, where
+the hardware prefetcher follows them as long as the list order matches the allocation order.
+So printList() stays a plain loop, and the list is made contiguous instead.
+
+Compaction:
+compact() copies the nodes into one contiguous block in traversal order and links them there (pointer rewrite).
+Later traversals read memory sequentially, which the hardware prefetcher handles by itself,
+so they run close to the speed of an array. Pointers to the old nodes become invalid.
+The result is a CompactList: it owns the block and frees it as a whole, and hands out only const nodes,
+so deleteNode() and the other functions that free or link single nodes cannot be called on it.
+
+The driver sums a list whose nodes were linked in random order by pointer chasing, then after compaction,
+and a std::vector with the same data (pass n as the first argument).
+
+Time Complexity:
+traversal: O(n)
+compact(): O(n), one allocation
+*/
+
+#include <bits/stdc++.h>
+#include "LinkedList.h"
+using namespace std;
+using namespace lists;
+
+// This function prints contents of linked list
+// starting from the given node
+void printList(const Node* n){
+   while (n != NULL){
+      cout << n->data << " ";
+      n = n->next;
+   }
+}
+
+// Sums the list, plain pointer chasing
+long long sumList(const Node* node){
+   long long sum = 0;
+   for (; node != NULL; node = node->next)
+      sum += node->data;
+   return sum;
+}
+
+template <typename F>
+double timeMs(F f){
+   auto start = chrono::steady_clock::now();
+   f();
+   return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// Driver code
+int main(int argc, char** argv){
+   Node* head = NULL;
+   for (int i = 5; i >= 1; i--)
+      head = new Node{ i, head };
+   printList(head);
+   CompactList small = compact(head);
+   cout << "(compacted: ";
+   printList(small.front());
+   cout << ")\n";
+
+   // Allocate the nodes, then link them in random order: a list built over time
+   int n = (argc > 1) ? atoi(argv[1]) : 4000000;
+   vector<Node*> nodes(n);
+   for (int i = 0; i < n; i++)
+      nodes[i] = new Node{ i, NULL };
+   shuffle(nodes.begin(), nodes.end(), mt19937(1));
+   for (int i = 0; i + 1 < n; i++)
+      nodes[i]->next = nodes[i + 1];
+   Node* list = (n > 0) ? nodes[0] : NULL;
+   vector<int> values;
+   for (Node* p = list; p != NULL; p = p->next)
+      values.push_back(p->data);
+
+   long long s1 = 0, s2 = 0, s3 = 0;
+   double scattered = timeMs([&]{ s1 = sumList(list); });
+   CompactList compacted = compact(list);
+   double sequential = timeMs([&]{ s2 = sumList(compacted.front()); });
+   double vec = timeMs([&]{ for (int v : values) s3 += v; });
+   cout << "Sum of " << n << " nodes: scattered " << scattered << " ms, compacted " << sequential
+        << " ms, vector " << vec << " ms" << (s1 == s2 && s2 == s3 ? "" : " (sums differ!)") << endl;
+   return 0;
+}
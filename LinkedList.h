@@ -0,0 +1,1248 @@
+/* Linked List structures (Linked List.cpp describes each one):
+NodePool         - nodes handed out from chunks, push()/insertAfter()/append()/deleteNode() that use it
+UNode            - unrolled linked list, 13 elements per cache-line node
+LinkedList       - owning list class with a tail pointer and a size
+LockFreeList     - lock-free sorted list (Harris) with epoch-based reclamation
+TreiberStack     - lock-free stack, many producers and one consumer
+MPSCQueue        - intrusive queue, many producers and one consumer
+SkipList         - skip list with pooled nodes and range iteration
+mergeSort()      - bottom-up merge sort of a list, and arraySort() (sort an array of the nodes and relink)
+IndexedList      - skip list with link widths, O(log(n)) access by position
+ListArena        - buildList() and deleteIf() on batches, splice()
+CompactList      - compact() moves a list into one contiguous block that it owns
+*/
+
+#ifndef LINKED_LIST_H
+#define LINKED_LIST_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <algorithm>
+#include <utility>
+#include <new>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace lists {
+
+// A linked list node
+class Node{
+    public:
+      int data;
+      Node *next;
+};
+
+class NodePool{
+   static const int CHUNK = 4096; // nodes per chunk
+   std::vector<Node*> chunks; // every chunk allocated so far
+   Node *freeList; // released nodes, linked through next
+   int used; // nodes handed out from the last chunk
+public:
+    NodePool() : freeList(NULL), used(CHUNK) {}
+    ~NodePool() { reset(); }
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+    // Returns an uninitialized node
+    Node* allocate();
+    // Gives back one node
+    void release(Node* node);
+    // Gives back every node of the list starting at head
+    void releaseList(Node* head);
+    // Frees all chunks; every node from this pool becomes invalid
+    void reset();
+};
+
+inline Node* NodePool::allocate(){
+   if (freeList != NULL){
+      Node* node = freeList;
+      freeList = node->next;
+      return node;
+   }
+   if (used == CHUNK){
+      chunks.push_back(static_cast<Node*>(::operator new(CHUNK * sizeof(Node))));
+      used = 0;
+   }
+   return &chunks.back()[used++];
+}
+
+inline void NodePool::release(Node* node){
+   node->next = freeList;
+   freeList = node;
+}
+
+inline void NodePool::releaseList(Node* head){
+   if (head == NULL)
+      return;
+   Node* last = head;
+   while (last->next != NULL)
+      last = last->next;
+   last->next = freeList;
+   freeList = head;
+}
+
+inline void NodePool::reset(){
+   for (Node* chunk : chunks)
+      ::operator delete(chunk);
+   chunks.clear();
+   freeList = NULL;
+   used = CHUNK;
+}
+
+/* Given a reference (pointer to pointer)
+to the head of a list and an int, inserts
+a new node on the front of the list. */
+inline void push(NodePool& pool, Node** head_ref, int new_data){
+    Node* new_node = pool.allocate();
+    new_node->data = new_data;
+    new_node->next = (*head_ref);
+    (*head_ref) = new_node;
+}
+
+/* Given a node prev_node, insert a new node after the given
+prev_node */
+inline void insertAfter(NodePool& pool, Node* prev_node, int new_data){
+    if (prev_node == NULL){
+      std::cout<<"the given previous node cannot be NULL";
+    return;
+    }
+    Node* new_node = pool.allocate();
+    new_node->data = new_data;
+    new_node->next = prev_node->next;
+    prev_node->next = new_node;
+}
+
+/* Given a reference (pointer to pointer) to the head
+of a list and an int, appends a new node at the end */
+inline void append(NodePool& pool, Node** head_ref, int new_data){
+    Node* new_node = pool.allocate();
+    Node *last = *head_ref;
+    new_node->data = new_data;
+    new_node->next = NULL;
+    if (*head_ref == NULL){
+       *head_ref = new_node;
+       return;
+    }
+    while (last->next != NULL)
+        last = last->next;
+    last->next = new_node;
+}
+
+/* Given a reference (pointer to pointer) to the head of a list
+   and a key, deletes the first occurrence of key in linked list */
+inline void deleteNode(NodePool& pool, Node **head_ref, int key){
+    Node* temp = *head_ref, *prev = NULL;
+    while (temp != NULL && temp->data != key){
+        prev = temp;
+        temp = temp->next;
+    }
+    // If key was not present in linked list
+    if (temp == NULL) return;
+    if (prev == NULL)
+        *head_ref = temp->next;
+    else
+        prev->next = temp->next;
+    pool.release(temp);  // Back to the pool, not to free()
+}
+
+const int NODE_CAP = 13; // 8 + 4 + 13 * 4 = 64 bytes with the header
+
+// A node of the unrolled linked list, one cache line
+class alignas(64) UNode{
+   public:
+      UNode *next;
+      int count;
+      int data[NODE_CAP];
+};
+
+inline UNode* newUNode(UNode* next){
+    UNode* node = new UNode();
+    node->count = 0;
+    node->next = next;
+    return node;
+}
+
+/* Inserts x at position i of node, which must not be full */
+inline void insertInto(UNode* node, int i, int x){
+    memmove(&node->data[i + 1], &node->data[i], (node->count - i) * sizeof(int));
+    node->data[i] = x;
+    node->count++;
+}
+
+/* Given a reference (pointer to pointer)
+to the head of a list and an int, inserts
+a new element on the front of the list. */
+inline void push(UNode** head_ref, int new_data){
+    if (*head_ref == NULL || (*head_ref)->count == NODE_CAP)
+        *head_ref = newUNode(*head_ref);
+    insertInto(*head_ref, 0, new_data);
+}
+
+/* Inserts a new element after element i of node.
+A full node is split in two so that both halves have room. */
+inline void insertAfter(UNode* node, int i, int new_data){
+    if (node == NULL || i < 0 || i >= node->count){
+        std::cout<<"the given previous element does not exist";
+        return;
+    }
+    int pos = i + 1;
+    if (node->count == NODE_CAP){
+        UNode* second = newUNode(node->next);
+        int half = NODE_CAP / 2;
+        second->count = NODE_CAP - half;
+        memcpy(second->data, &node->data[half], second->count * sizeof(int));
+        node->count = half;
+        node->next = second;
+        if (pos > half){
+            node = second;
+            pos -= half;
+        }
+    }
+    insertInto(node, pos, new_data);
+}
+
+/* Given a reference (pointer to pointer) to the head
+of a list and an int, appends a new element at the end */
+inline void append(UNode** head_ref, int new_data){
+    if (*head_ref == NULL){
+        *head_ref = newUNode(NULL);
+        insertInto(*head_ref, 0, new_data);
+        return;
+    }
+    UNode* last = *head_ref;
+    while (last->next != NULL)
+        last = last->next;
+    if (last->count == NODE_CAP){
+        last->next = newUNode(NULL);
+        last = last->next;
+    }
+    last->data[last->count++] = new_data;
+}
+
+/* Removes element i of node (prev is its predecessor, NULL for the head)
+and keeps the node at least half full by borrowing from or merging with the next node */
+inline void removeAt(UNode** head_ref, UNode* prev, UNode* node, int i){
+    memmove(&node->data[i], &node->data[i + 1], (node->count - i - 1) * sizeof(int));
+    node->count--;
+    if (node->count == 0){
+        // Unlink the empty node
+        if (prev == NULL)
+            *head_ref = node->next;
+        else
+            prev->next = node->next;
+        delete node;
+        return;
+    }
+    UNode* next = node->next;
+    if (node->count >= NODE_CAP / 2 || next == NULL)
+        return;
+    if (node->count + next->count <= NODE_CAP){
+        // Merge the successor into this node
+        memcpy(&node->data[node->count], next->data, next->count * sizeof(int));
+        node->count += next->count;
+        node->next = next->next;
+        delete next;
+    } else {
+        // Borrow the first element of the successor
+        node->data[node->count++] = next->data[0];
+        memmove(&next->data[0], &next->data[1], (next->count - 1) * sizeof(int));
+        next->count--;
+    }
+}
+
+/* Given a reference (pointer to pointer) to the head of a list
+   and a key, deletes the first occurrence of key in linked list */
+inline void deleteNode(UNode** head_ref, int key){
+    UNode* prev = NULL;
+    for (UNode* node = *head_ref; node != NULL; prev = node, node = node->next)
+        for (int i = 0; i < node->count; i++)
+            if (node->data[i] == key){
+                removeAt(head_ref, prev, node, i);
+                return;
+            }
+}
+
+/* Given a reference (pointer to pointer) to the head of a list
+   and a position, deletes the element at the given position */
+inline void deleteNodeAt(UNode** head_ref, int position){
+    if (position < 0)
+        return;
+    UNode* prev = NULL;
+    UNode* node = *head_ref;
+    // Skip whole nodes by their counts
+    while (node != NULL && position >= node->count){
+        position -= node->count;
+        prev = node;
+        node = node->next;
+    }
+    // If position is more than number of elements
+    if (node == NULL)
+        return;
+    removeAt(head_ref, prev, node, position);
+}
+
+inline void freeList(UNode* node){
+   while (node != NULL){
+      UNode* next = node->next;
+      delete node;
+      node = next;
+   }
+}
+
+class LinkedList{
+   Node *head; // first node, NULL if the list is empty
+   Node *tail; // last node, NULL if the list is empty
+   int count; // number of nodes
+public:
+    LinkedList() : head(NULL), tail(NULL), count(0) {}
+    ~LinkedList() { clear(); }
+    LinkedList(const LinkedList&) = delete;
+    LinkedList& operator=(const LinkedList&) = delete;
+    // Takes over the nodes of other, which is left empty
+    LinkedList(LinkedList&& other) noexcept : head(other.head), tail(other.tail), count(other.count){
+       other.head = other.tail = NULL;
+       other.count = 0;
+    }
+    LinkedList& operator=(LinkedList&& other) noexcept;
+    // Inserts a new node on the front of the list
+    void push(int new_data);
+    // Appends a new node at the end
+    void append(int new_data);
+    // Inserts a new node after prev_node, which must belong to this list
+    void insertAfter(Node* prev_node, int new_data);
+    // Deletes the first occurrence of key
+    void deleteNode(int key);
+    // Deletes the node at the given position
+    void deleteNodeAt(int position);
+    // Moves all nodes of other to the end of this list, other is left empty
+    void splice(LinkedList& other);
+    // Deletes all nodes
+    void clear();
+    int size() const { return count; }
+    Node* front() const { return head; }
+    Node* back() const { return tail; }
+};
+
+inline LinkedList& LinkedList::operator=(LinkedList&& other) noexcept{
+   if (this != &other){
+      clear();
+      head = other.head;
+      tail = other.tail;
+      count = other.count;
+      other.head = other.tail = NULL;
+      other.count = 0;
+   }
+   return *this;
+}
+
+inline void LinkedList::push(int new_data){
+    Node* new_node = new Node();
+    new_node->data = new_data;
+    new_node->next = head;
+    head = new_node;
+    if (tail == NULL)
+        tail = new_node;
+    count++;
+}
+
+inline void LinkedList::append(int new_data){
+    Node* new_node = new Node();
+    new_node->data = new_data;
+    new_node->next = NULL;
+    // No traversal: link after the known last node
+    if (tail == NULL)
+        head = new_node;
+    else
+        tail->next = new_node;
+    tail = new_node;
+    count++;
+}
+
+inline void LinkedList::insertAfter(Node* prev_node, int new_data){
+    if (prev_node == NULL){
+      std::cout<<"the given previous node cannot be NULL";
+    return;
+    }
+    Node* new_node = new Node();
+    new_node->data = new_data;
+    new_node->next = prev_node->next;
+    prev_node->next = new_node;
+    if (prev_node == tail)
+        tail = new_node;
+    count++;
+}
+
+inline void LinkedList::deleteNode(int key){
+    Node *temp = head, *prev = NULL;
+    while (temp != NULL && temp->data != key){
+        prev = temp;
+        temp = temp->next;
+    }
+    // If key was not present in linked list
+    if (temp == NULL) return;
+    if (prev == NULL)
+        head = temp->next;
+    else
+        prev->next = temp->next;
+    if (temp == tail)
+        tail = prev;
+    delete temp;
+    count--;
+}
+
+inline void LinkedList::deleteNodeAt(int position){
+    // If position is more than number of nodes
+    if (position < 0 || position >= count)
+        return;
+    Node *temp = head, *prev = NULL;
+    for (int i = 0; i < position; i++){
+        prev = temp;
+        temp = temp->next;
+    }
+    if (prev == NULL)
+        head = temp->next;
+    else
+        prev->next = temp->next;
+    if (temp == tail)
+        tail = prev;
+    delete temp;
+    count--;
+}
+
+inline void LinkedList::splice(LinkedList& other){
+    if (this == &other || other.head == NULL)
+        return;
+    if (tail == NULL)
+        head = other.head;
+    else
+        tail->next = other.head;
+    tail = other.tail;
+    count += other.count;
+    other.head = other.tail = NULL;
+    other.count = 0;
+}
+
+inline void LinkedList::clear(){
+    while (head != NULL){
+        Node* next = head->next;
+        delete head;
+        head = next;
+    }
+    tail = NULL;
+    count = 0;
+}
+
+// A node of the lock-free list; the lowest bit of next marks the node as deleted
+struct LFNode{
+    int key;
+    std::atomic<uintptr_t> next;
+    LFNode(int k) : key(k), next(0) {}
+};
+
+inline LFNode* ptrOf(uintptr_t p) { return (LFNode*)(p & ~(uintptr_t)1); }
+inline bool isMarked(uintptr_t p) { return (p & 1) != 0; }
+
+const int RETIRE_BATCH = 64; // retired nodes between attempts to advance the epoch
+const uint64_t QUIESCENT = ~(uint64_t)0; // announced by a thread outside any operation
+
+inline std::atomic<uint64_t> globalEpoch(0);
+
+// One per thread, on its own cache line so announcements do not false-share.
+// Records are only added to the list, never removed, so they can be read without protection.
+struct alignas(64) EpochRecord{
+    std::atomic<uint64_t> epoch;
+    std::atomic<bool> inUse;
+    EpochRecord* next;
+    EpochRecord() : epoch(QUIESCENT), inUse(true), next(NULL) {}
+};
+inline std::atomic<EpochRecord*> records(NULL);
+
+struct Retired{
+    LFNode* node;
+    uint64_t epoch; // global epoch when the node was unlinked
+};
+
+// Nodes retired by threads that exited before they could free them
+inline std::mutex orphanLock;
+inline std::vector<Retired> orphans;
+
+// Frees the orphans when the program ends, after every thread has finished
+struct OrphanReaper{
+    ~OrphanReaper(){
+        for (Retired& r : orphans)
+            delete r.node;
+    }
+};
+inline OrphanReaper orphanReaper;
+
+// Moves the global epoch on if every active thread has announced the current one
+inline void tryAdvanceEpoch(){
+    uint64_t e = globalEpoch.load();
+    for (EpochRecord* r = records.load(); r != NULL; r = r->next){
+        uint64_t local = r->epoch.load();
+        if (local != QUIESCENT && local != e)
+            return;
+    }
+    globalEpoch.compare_exchange_strong(e, e + 1);
+}
+
+// Frees the nodes retired at least two epochs ago, keeps the others
+inline void freeRetired(std::vector<Retired>& retired){
+    uint64_t e = globalEpoch.load();
+    size_t kept = 0;
+    for (Retired& r : retired){
+        if (r.epoch + 2 <= e)
+            delete r.node;
+        else
+            retired[kept++] = r;
+    }
+    retired.resize(kept);
+}
+
+// Per-thread state: its epoch record and its retired nodes
+struct ThreadState{
+    EpochRecord* record;
+    std::vector<Retired> retired;
+    ThreadState() : record(NULL){
+        // Reuse the record of a thread that has exited
+        for (EpochRecord* r = records.load(); r != NULL; r = r->next){
+            bool expected = false;
+            if (r->inUse.compare_exchange_strong(expected, true)){
+                r->epoch = QUIESCENT;
+                record = r;
+                return;
+            }
+        }
+        // None free: add a new one in front
+        record = new EpochRecord();
+        EpochRecord* first = records.load();
+        do {
+            record->next = first;
+        } while (!records.compare_exchange_weak(first, record));
+    }
+    ~ThreadState(){
+        record->epoch = QUIESCENT;
+        tryAdvanceEpoch();
+        freeRetired(retired);
+        std::lock_guard<std::mutex> guard(orphanLock);
+        orphans.insert(orphans.end(), retired.begin(), retired.end());
+        record->inUse = false;
+    }
+    // Announces the current epoch; list pointers read after this stay valid until leave()
+    void enter() { record->epoch.store(globalEpoch.load()); }
+    void leave() { record->epoch.store(QUIESCENT, std::memory_order_release); }
+    void retire(LFNode* node){
+        retired.push_back({ node, globalEpoch.load() });
+        if ((int)retired.size() % RETIRE_BATCH == 0){
+            tryAdvanceEpoch();
+            freeRetired(retired);
+            // Take over what exited threads left behind
+            std::unique_lock<std::mutex> guard(orphanLock, std::try_to_lock);
+            if (guard.owns_lock() && !orphans.empty()){
+                retired.insert(retired.end(), orphans.begin(), orphans.end());
+                orphans.clear();
+            }
+        }
+    }
+};
+
+inline ThreadState& threadState(){
+    static thread_local ThreadState state;
+    return state;
+}
+
+class LockFreeList{
+    std::atomic<uintptr_t> head;
+    // Finds the first unmarked node cur with key >= given key and the link prev that points to it.
+    // Unlinks the marked nodes it passes. Must be called between enter() and leave().
+    bool find(int key, std::atomic<uintptr_t>*& prev, LFNode*& cur, uintptr_t& next, ThreadState& ts);
+public:
+    LockFreeList() : head(0) {}
+    // Not thread-safe: no other thread may use the list any more
+    ~LockFreeList();
+    bool insert(int key);
+    bool remove(int key);
+    bool contains(int key);
+    // Copies the keys into out; only meaningful while no other thread modifies the list
+    void snapshot(std::vector<int>& out);
+};
+
+inline bool LockFreeList::find(int key, std::atomic<uintptr_t>*& prev, LFNode*& cur, uintptr_t& next, ThreadState& ts){
+try_again:
+    prev = &head;
+    cur = ptrOf(prev->load(std::memory_order_acquire));
+    while (true){
+        if (cur == NULL)
+            return false;
+        next = cur->next.load(std::memory_order_acquire);
+        if (isMarked(next)){
+            // cur is logically deleted: unlink it, then continue from prev.
+            // The CAS fails if prev was marked or changed meanwhile.
+            uintptr_t expected = (uintptr_t)cur;
+            if (!prev->compare_exchange_strong(expected, next & ~(uintptr_t)1))
+                goto try_again;
+            ts.retire(cur);
+            cur = ptrOf(next);
+            continue;
+        }
+        if (cur->key >= key)
+            return cur->key == key;
+        prev = &cur->next;
+        cur = ptrOf(next);
+    }
+}
+
+inline bool LockFreeList::insert(int key){
+    ThreadState& ts = threadState();
+    LFNode* node = NULL;
+    std::atomic<uintptr_t>* prev;
+    LFNode* cur;
+    uintptr_t next;
+    bool inserted;
+    ts.enter();
+    while (true){
+        if (find(key, prev, cur, next, ts)){
+            delete node; // key already present, node was never shared
+            inserted = false;
+            break;
+        }
+        if (node == NULL)
+            node = new LFNode(key);
+        node->next.store((uintptr_t)cur, std::memory_order_relaxed);
+        uintptr_t expected = (uintptr_t)cur;
+        if (prev->compare_exchange_strong(expected, (uintptr_t)node)){
+            inserted = true;
+            break;
+        }
+    }
+    ts.leave();
+    return inserted;
+}
+
+inline bool LockFreeList::remove(int key){
+    ThreadState& ts = threadState();
+    std::atomic<uintptr_t>* prev;
+    LFNode* cur;
+    uintptr_t next;
+    bool removed;
+    ts.enter();
+    while (true){
+        if (!find(key, prev, cur, next, ts)){
+            removed = false;
+            break;
+        }
+        // 1. logical delete: mark cur->next
+        if (!cur->next.compare_exchange_strong(next, next | 1))
+            continue;
+        // 2. physical delete: unlink, or leave it to the next find() that passes by
+        uintptr_t expected = (uintptr_t)cur;
+        if (prev->compare_exchange_strong(expected, next))
+            ts.retire(cur);
+        else
+            find(key, prev, cur, next, ts);
+        removed = true;
+        break;
+    }
+    ts.leave();
+    return removed;
+}
+
+inline bool LockFreeList::contains(int key){
+    ThreadState& ts = threadState();
+    std::atomic<uintptr_t>* prev;
+    LFNode* cur;
+    uintptr_t next;
+    ts.enter();
+    bool found = find(key, prev, cur, next, ts);
+    ts.leave();
+    return found;
+}
+
+inline LockFreeList::~LockFreeList(){
+    LFNode* node = ptrOf(head.load());
+    while (node != NULL){
+        LFNode* next = ptrOf(node->next.load());
+        delete node;
+        node = next;
+    }
+}
+
+inline void LockFreeList::snapshot(std::vector<int>& out){
+    out.clear();
+    for (LFNode* node = ptrOf(head.load()); node != NULL; ){
+        uintptr_t next = node->next.load();
+        if (!isMarked(next))
+            out.push_back(node->key);
+        node = ptrOf(next);
+    }
+}
+
+// A linked list node whose link can be updated atomically
+struct AtomicNode{
+    int data;
+    std::atomic<AtomicNode*> next;
+    AtomicNode(int d = 0) : data(d), next(NULL) {}
+};
+
+// push() and pushList() from any number of threads; pop() and popAll() from one consumer thread
+class TreiberStack{
+    std::atomic<AtomicNode*> head;
+public:
+    TreiberStack() : head(NULL) {}
+    // Any number of threads
+    void push(AtomicNode* node){
+        AtomicNode* top = head.load(std::memory_order_relaxed);
+        do {
+            node->next.store(top, std::memory_order_relaxed);
+        } while (!head.compare_exchange_weak(top, node, std::memory_order_release, std::memory_order_relaxed));
+    }
+    // Pushes the chain first..last (already linked) with a single CAS
+    void pushList(AtomicNode* first, AtomicNode* last){
+        AtomicNode* top = head.load(std::memory_order_relaxed);
+        do {
+            last->next.store(top, std::memory_order_relaxed);
+        } while (!head.compare_exchange_weak(top, first, std::memory_order_release, std::memory_order_relaxed));
+    }
+    // Detaches the whole stack (newest first); the consumer thread only (see ABA in Linked List.cpp)
+    AtomicNode* popAll(){
+        return head.exchange(NULL, std::memory_order_acquire);
+    }
+    // Removes the newest node, NULL if empty; the consumer thread only (see ABA in Linked List.cpp)
+    AtomicNode* pop(){
+        AtomicNode* top = head.load(std::memory_order_acquire);
+        while (top != NULL &&
+               !head.compare_exchange_weak(top, top->next.load(std::memory_order_relaxed),
+                                           std::memory_order_acquire, std::memory_order_acquire))
+            ;
+        return top;
+    }
+};
+
+// Reverses a detached list, to consume a popAll() batch oldest first
+inline AtomicNode* reverseList(AtomicNode* node){
+    AtomicNode* prev = NULL;
+    while (node != NULL){
+        AtomicNode* next = node->next.load(std::memory_order_relaxed);
+        node->next.store(prev, std::memory_order_relaxed);
+        prev = node;
+        node = next;
+    }
+    return prev;
+}
+
+class MPSCQueue{
+    alignas(64) std::atomic<AtomicNode*> head; // last pushed node, written by producers
+    alignas(64) AtomicNode* tail; // next node to pop, owned by the consumer
+    AtomicNode stub;
+public:
+    MPSCQueue() : head(&stub), tail(&stub) {}
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+    // Any number of threads
+    void push(AtomicNode* node){
+        node->next.store(NULL, std::memory_order_relaxed);
+        AtomicNode* prev = head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+    // Oldest node, NULL if empty (or a push is half done); one consumer thread only
+    AtomicNode* pop(){
+        AtomicNode* t = tail;
+        AtomicNode* next = t->next.load(std::memory_order_acquire);
+        if (t == &stub){
+            if (next == NULL)
+                return NULL;
+            // Skip the stub
+            tail = next;
+            t = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next != NULL){
+            tail = next;
+            return t;
+        }
+        // t is the last node; a producer may be linking a new one after it
+        if (t != head.load(std::memory_order_acquire))
+            return NULL;
+        // Put the stub back behind t so that t can be handed out
+        push(&stub);
+        next = t->next.load(std::memory_order_acquire);
+        if (next != NULL){
+            tail = next;
+            return t;
+        }
+        return NULL;
+    }
+};
+
+const int MAX_LEVEL = 24;
+
+// A skip list node: its key and height next pointers, allocated with the right size
+struct SkipNode{
+    int key;
+    int height;
+    SkipNode* next[1]; // really next[height]
+};
+
+// Hands out nodes of any height from chunks; freed nodes are kept per height for reuse
+class SkipPool{
+    static const size_t CHUNK = 1 << 20; // bytes per chunk
+    std::vector<char*> chunks;
+    size_t used = CHUNK;
+    SkipNode* freeList[MAX_LEVEL + 1] = {};
+public:
+    ~SkipPool(){
+        for (char* c : chunks)
+            delete[] c;
+    }
+    SkipNode* allocate(int height){
+        SkipNode* node = freeList[height];
+        if (node != NULL){
+            freeList[height] = node->next[0];
+            return node;
+        }
+        size_t bytes = offsetof(SkipNode, next) + height * sizeof(SkipNode*);
+        bytes = (bytes + alignof(SkipNode) - 1) / alignof(SkipNode) * alignof(SkipNode);
+        if (used + bytes > CHUNK){
+            chunks.push_back(new char[CHUNK]);
+            used = 0;
+        }
+        node = (SkipNode*)(chunks.back() + used);
+        used += bytes;
+        node->height = height;
+        return node;
+    }
+    void release(SkipNode* node){
+        node->next[0] = freeList[node->height];
+        freeList[node->height] = node;
+    }
+};
+
+class SkipList{
+    SkipPool pool;
+    SkipNode* head; // sentinel with MAX_LEVEL pointers
+    int level; // number of levels in use
+    int count;
+    std::mt19937 gen;
+    int randomHeight();
+    // Fills update[i] with the last node on level i whose key is < key; returns the level-0 successor
+    SkipNode* findPredecessors(int key, SkipNode* update[]);
+public:
+    SkipList();
+    SkipList(const SkipList&) = delete;
+    SkipList& operator=(const SkipList&) = delete;
+    bool search(int key);
+    void insert(int key);
+    // Deletes one occurrence of key; returns false if it is not present
+    bool remove(int key);
+    // Calls visit(key) for every key in [lo, hi] in increasing order
+    template <typename Visit>
+    void range(int lo, int hi, Visit visit);
+    int size() { return count; }
+};
+
+inline SkipList::SkipList() : level(1), count(0), gen(12345){
+    head = pool.allocate(MAX_LEVEL);
+    head->key = INT_MIN;
+    for (int i = 0; i < MAX_LEVEL; i++)
+        head->next[i] = NULL;
+}
+
+// Height h with probability 1/2^h: one plus the number of trailing zero bits of a random number
+inline int SkipList::randomHeight(){
+    uint32_t r = gen() | (1u << (MAX_LEVEL - 1));
+    return 1 + __builtin_ctz(r);
+}
+
+inline SkipNode* SkipList::findPredecessors(int key, SkipNode* update[]){
+    SkipNode* x = head;
+    for (int i = level - 1; i >= 0; i--){
+        while (x->next[i] != NULL && x->next[i]->key < key)
+            x = x->next[i];
+        update[i] = x;
+    }
+    return x->next[0];
+}
+
+inline bool SkipList::search(int key){
+    SkipNode* x = head;
+    for (int i = level - 1; i >= 0; i--)
+        while (x->next[i] != NULL && x->next[i]->key < key)
+            x = x->next[i];
+    x = x->next[0];
+    return x != NULL && x->key == key;
+}
+
+inline void SkipList::insert(int key){
+    SkipNode* update[MAX_LEVEL];
+    findPredecessors(key, update);
+    int h = randomHeight();
+    if (h > level){
+        for (int i = level; i < h; i++)
+            update[i] = head;
+        level = h;
+    }
+    SkipNode* node = pool.allocate(h);
+    node->key = key;
+    for (int i = 0; i < h; i++){
+        node->next[i] = update[i]->next[i];
+        update[i]->next[i] = node;
+    }
+    count++;
+}
+
+inline bool SkipList::remove(int key){
+    SkipNode* update[MAX_LEVEL];
+    SkipNode* x = findPredecessors(key, update);
+    if (x == NULL || x->key != key)
+        return false;
+    for (int i = 0; i < level && update[i]->next[i] == x; i++)
+        update[i]->next[i] = x->next[i];
+    while (level > 1 && head->next[level - 1] == NULL)
+        level--;
+    pool.release(x);
+    count--;
+    return true;
+}
+
+template <typename Visit>
+void SkipList::range(int lo, int hi, Visit visit){
+    SkipNode* update[MAX_LEVEL];
+    for (SkipNode* x = findPredecessors(lo, update); x != NULL && x->key <= hi; x = x->next[0])
+        visit(x->key);
+}
+
+// Merges two sorted lists; on equal keys the node of a comes first
+inline Node* mergeLists(Node* a, Node* b){
+    Node dummy;
+    Node* tail = &dummy;
+    while (a != NULL && b != NULL){
+        if (b->data < a->data){
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = (a != NULL) ? a : b;
+    return dummy.next;
+}
+
+// Bottom-up merge sort; *head_ref points to the sorted list afterwards
+inline void mergeSort(Node** head_ref){
+    Node* runs[64] = {};
+    Node* node = *head_ref;
+    while (node != NULL){
+        Node* carry = node;
+        node = node->next;
+        carry->next = NULL;
+        int i = 0;
+        for (; runs[i] != NULL; i++){
+            carry = mergeLists(runs[i], carry);
+            runs[i] = NULL;
+        }
+        runs[i] = carry;
+    }
+    Node* result = NULL;
+    for (int i = 0; i < 64; i++)
+        if (runs[i] != NULL)
+            result = mergeLists(runs[i], result);
+    *head_ref = result;
+}
+
+// Copies (key, node) pairs to an array, sorts it and relinks the nodes in that order
+inline void arraySort(Node** head_ref){
+    std::vector<std::pair<int, Node*>> items;
+    for (Node* n = *head_ref; n != NULL; n = n->next)
+        items.push_back({ n->data, n });
+    // Stable, so equal keys keep their list order like mergeSort()
+    std::stable_sort(items.begin(), items.end(),
+                [](const std::pair<int, Node*>& x, const std::pair<int, Node*>& y){ return x.first < y.first; });
+    Node* head = NULL;
+    for (size_t i = items.size(); i-- > 0; ){
+        items[i].second->next = head;
+        head = items[i].second;
+    }
+    *head_ref = head;
+}
+
+struct SINode;
+
+// A link of a skip list node: the next node on this level and how many positions it jumps
+struct Link{
+    SINode* next;
+    int width;
+};
+
+struct SINode{
+    int data;
+    int height;
+    Link link[1]; // really link[height]
+};
+
+class IndexedList{
+    SINode* head; // sentinel, step 0
+    int level;
+    int count;
+    std::mt19937 gen;
+    SINode* freeList[MAX_LEVEL + 1] = {}; // released nodes per height, reused by insertAt()
+    SINode* newNode(int height);
+    int randomHeight();
+    // Fills update[i] and rank[i] with the last node at step <= p on every level. Callers zero update[]:
+    // the compiler cannot see that level >= 1, so it would warn that update[0] may be uninitialized
+    void findPredecessors(int p, SINode* update[], int rank[]);
+public:
+    IndexedList();
+    ~IndexedList();
+    IndexedList(const IndexedList&) = delete;
+    IndexedList& operator=(const IndexedList&) = delete;
+    int size() { return count; }
+    // position must be in 0..size()-1
+    int get(int position);
+    void set(int position, int value);
+    // Inserts value so that it ends up at position (0..size())
+    void insertAt(int position, int value);
+    void push(int value) { insertAt(0, value); }
+    void append(int value) { insertAt(count, value); }
+    // Deletes the element at position (ignored if out of range)
+    void deleteAt(int position);
+    // Calls visit(value) for every element in order
+    template <typename Visit>
+    void forEach(Visit visit){
+        for (SINode* x = head->link[0].next; x != NULL; x = x->link[0].next)
+            visit(x->data);
+    }
+};
+
+inline SINode* IndexedList::newNode(int height){
+    SINode* node = freeList[height];
+    if (node != NULL){
+        freeList[height] = node->link[0].next;
+        return node;
+    }
+    node = (SINode*)::operator new(offsetof(SINode, link) + height * sizeof(Link));
+    node->height = height;
+    return node;
+}
+
+inline int IndexedList::randomHeight(){
+    uint32_t r = gen() | (1u << (MAX_LEVEL - 1));
+    return 1 + __builtin_ctz(r);
+}
+
+inline IndexedList::IndexedList() : level(1), count(0), gen(12345){
+    head = newNode(MAX_LEVEL);
+    for (int i = 0; i < MAX_LEVEL; i++)
+        head->link[i] = { NULL, 1 };
+}
+
+inline IndexedList::~IndexedList(){
+    SINode* x = head;
+    while (x != NULL){
+        SINode* next = x->link[0].next;
+        ::operator delete(x);
+        x = next;
+    }
+    for (int h = 0; h <= MAX_LEVEL; h++)
+        while (freeList[h] != NULL){
+            SINode* next = freeList[h]->link[0].next;
+            ::operator delete(freeList[h]);
+            freeList[h] = next;
+        }
+}
+
+inline void IndexedList::findPredecessors(int p, SINode* update[], int rank[]){
+    SINode* x = head;
+    int traversed = 0;
+    for (int i = level - 1; i >= 0; i--){
+        while (x->link[i].next != NULL && traversed + x->link[i].width <= p){
+            traversed += x->link[i].width;
+            x = x->link[i].next;
+        }
+        update[i] = x;
+        rank[i] = traversed;
+    }
+}
+
+inline int IndexedList::get(int position){
+    SINode* update[MAX_LEVEL] = {};
+    int rank[MAX_LEVEL];
+    findPredecessors(position + 1, update, rank);
+    return update[0]->data;
+}
+
+inline void IndexedList::set(int position, int value){
+    SINode* update[MAX_LEVEL] = {};
+    int rank[MAX_LEVEL];
+    findPredecessors(position + 1, update, rank);
+    update[0]->data = value;
+}
+
+inline void IndexedList::insertAt(int position, int value){
+    if (position < 0 || position > count)
+        return;
+    SINode* update[MAX_LEVEL] = {};
+    int rank[MAX_LEVEL];
+    findPredecessors(position, update, rank);
+    int h = randomHeight();
+    if (h > level){
+        // New levels start as one link from head to the virtual end
+        for (int i = level; i < h; i++){
+            update[i] = head;
+            rank[i] = 0;
+            head->link[i] = { NULL, count + 1 };
+        }
+        level = h;
+    }
+    SINode* node = newNode(h);
+    node->data = value;
+    for (int i = 0; i < h; i++){
+        // The new node is at step position + 1; split update[i]'s link there
+        int before = position - rank[i] + 1;
+        node->link[i] = { update[i]->link[i].next, update[i]->link[i].width - before + 1 };
+        update[i]->link[i] = { node, before };
+    }
+    for (int i = h; i < level; i++)
+        update[i]->link[i].width++;
+    count++;
+}
+
+inline void IndexedList::deleteAt(int position){
+    if (position < 0 || position >= count)
+        return;
+    SINode* update[MAX_LEVEL] = {};
+    int rank[MAX_LEVEL];
+    findPredecessors(position, update, rank);
+    SINode* x = update[0]->link[0].next;
+    for (int i = 0; i < level; i++){
+        if (update[i]->link[i].next == x)
+            update[i]->link[i] = { x->link[i].next, update[i]->link[i].width + x->link[i].width - 1 };
+        else
+            update[i]->link[i].width--;
+    }
+    while (level > 1 && head->link[level - 1].next == NULL)
+        level--;
+    x->link[0].next = freeList[x->height];
+    freeList[x->height] = x;
+    count--;
+}
+
+class ListArena{
+    std::vector<Node*> blocks; // every block allocated by buildList()
+    Node* freeList = NULL; // removed nodes, linked through next
+public:
+    ListArena() {}
+    ~ListArena(){
+        for (Node* b : blocks)
+            delete[] b;
+    }
+    ListArena(const ListArena&) = delete;
+    ListArena& operator=(const ListArena&) = delete;
+
+    // Builds a list holding arr[0..n-1] in order; *tail_ref receives the last node (for splice)
+    Node* buildList(const int arr[], int n, Node** tail_ref){
+        if (n <= 0){
+            if (tail_ref != NULL)
+                *tail_ref = NULL;
+            return NULL;
+        }
+        Node* block = new Node[n];
+        blocks.push_back(block);
+        for (int i = 0; i < n; i++){
+            block[i].data = arr[i];
+            block[i].next = &block[i + 1];
+        }
+        block[n - 1].next = NULL;
+        if (tail_ref != NULL)
+            *tail_ref = &block[n - 1];
+        return block;
+    }
+
+    // Unlinks every node for which pred(data) is true, in one traversal; returns how many
+    template <typename Pred>
+    int deleteIf(Node** head_ref, Pred pred){
+        int removed = 0;
+        Node** link = head_ref;
+        while (*link != NULL){
+            Node* node = *link;
+            if (pred(node->data)){
+                *link = node->next; // unlink
+                node->next = freeList;
+                freeList = node;
+                removed++;
+            } else {
+                link = &node->next;
+            }
+        }
+        return removed;
+    }
+
+    // Takes a node from the free list or a new one-node block
+    Node* allocate(int data){
+        Node* node = freeList;
+        if (node != NULL)
+            freeList = node->next;
+        else {
+            node = new Node[1];
+            blocks.push_back(node);
+        }
+        node->data = data;
+        node->next = NULL;
+        return node;
+    }
+};
+
+/* Links the chain first..last after prev_node in O(1).
+If prev_node is NULL the chain is put in front of *head_ref. */
+inline void splice(Node** head_ref, Node* prev_node, Node* first, Node* last){
+    if (first == NULL)
+        return;
+    if (prev_node == NULL){
+        last->next = *head_ref;
+        *head_ref = first;
+    } else {
+        last->next = prev_node->next;
+        prev_node->next = first;
+    }
+}
+
+/* A list moved into one contiguous block by compact(). It owns the block and frees it as a whole;
+its nodes are read-only, so push(), deleteNode() and the other per-node functions cannot be used on them. */
+class CompactList{
+   std::unique_ptr<Node[]> block;
+   friend CompactList compact(Node* head);
+public:
+   const Node* front() const { return block.get(); }
+};
+
+/* Moves the list into one contiguous block in traversal order and frees the old nodes
+(which must have been allocated one by one with new). */
+inline CompactList compact(Node* head){
+   int n = 0;
+   for (Node* p = head; p != NULL; p = p->next)
+      n++;
+   CompactList list;
+   if (n == 0)
+      return list;
+   list.block = std::make_unique<Node[]>(n);
+   Node* block = list.block.get();
+   Node* p = head;
+   for (int i = 0; i < n; i++){
+      block[i].data = p->data;
+      block[i].next = (i + 1 < n) ? &block[i + 1] : NULL;
+      Node* old = p;
+      p = p->next;
+      delete old;
+   }
+   return list;
+}
+
+} // namespace lists
+
+#endif
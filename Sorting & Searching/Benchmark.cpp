@@ -0,0 +1,353 @@
+/* Benchmark
+Measures every algorithm of this folder on the same inputs and prints the results as CSV or JSON,
+so that runs can be compared with each other (and regressions found) by a script.
+
+Algorithms: sort (sort() of Sort.h, which chooses the algorithm), quickSort, mergeSort, heapSort, insertionSort,
+            selectionSort, bubbleSort (sorts), binarySearch, search (lookups in an array of n elements),
+            MinHeap (n insertKey() then n extractMin()).
+They are the functions of this folder's headers (namespace sorting), the code the sections and sort() use:
+quickSort and mergeSort are the engines of sort() (median of three pivot with a heap sort fallback, one merge buffer),
+bubbleSort stops after a pass without swaps and search is the vectorized scan.
+The sorts count their comparisons and swaps through the Count policy of Counter.h
+(a single element moved, as insertion and merge sort do, counts as a swap); without it they run the plain code.
+
+Distributions: random, sorted, reversed, few-unique (16 values), organ-pipe (ascending then descending),
+               zipf (value k with probability proportional to 1/k).
+Searches run on the sorted data; half of the keys are in the array, half are random.
+
+For each algorithm, distribution and size:
+1. A first run checks the output (sorted, or as many keys found as with std::binary_search);
+   for the sorts it also counts the comparisons and swaps per element. The searches and MinHeap are not counted
+   (empty in CSV, null in JSON).
+2. reps timed runs give the time per element (per lookup for the searches): mean, standard deviation and minimum.
+   Small inputs are repeated in a batch of copies so that one timed run takes long enough to measure.
+Quadratic cases (selection sort, and insertion and bubble sort on anything but sorted data)
+are skipped above --max-quadratic elements.
+
+Usage:
+Benchmark [--algorithms sort,quick,merge,...] [--distributions random,sorted,...] [--sizes 10,1000,1000000]
+          [--reps 5] [--format csv|json] [--max-quadratic 16384] [--seed 1]
+Every option takes a value. Sizes are integers from 1 to 2^31-1; up to 10^9 works if memory allows
+(8 bytes per element for the sorts: the input and the copy being sorted).
+*/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <climits>
+#include "Sort.h"
+#include "BubbleSort.h"
+#include "SelectionSort.h"
+#include "LinearSearch.h"
+#include "BinarySearch.h"
+#include "BinaryHeap.h"
+using namespace std;
+using namespace sorting;
+
+const vector<string> ALGORITHMS = { "sort", "quick", "merge", "heap", "insertion", "selection", "bubble", "binarysearch", "search", "minheap" };
+const vector<string> DISTRIBUTIONS = { "random", "sorted", "reversed", "few-unique", "organ-pipe", "zipf" };
+
+vector<int> makeInput(const string& dist, int n, mt19937& gen){
+   vector<int> a(n);
+   if (dist == "random"){
+      for (int& v : a)
+         v = (int)gen();
+   } else if (dist == "sorted" || dist == "reversed"){
+      for (int i = 0; i < n; i++)
+         a[i] = (dist == "sorted") ? i : n - i;
+   } else if (dist == "few-unique"){
+      for (int& v : a)
+         v = (int)(gen() % 16);
+   } else if (dist == "organ-pipe"){
+      for (int i = 0; i < n; i++)
+         a[i] = (i < n / 2) ? i : n - i;
+   } else if (dist == "zipf"){
+      // P(k) proportional to 1/k over k = 1..K, drawn through the cumulative weights
+      int K = min(n, 1 << 20);
+      vector<double> cumulative(K);
+      double sum = 0;
+      for (int k = 0; k < K; k++)
+         cumulative[k] = sum += 1.0 / (k + 1);
+      uniform_real_distribution<double> u(0, sum);
+      for (int& v : a)
+         v = (int)(upper_bound(cumulative.begin(), cumulative.end(), u(gen)) - cumulative.begin()) + 1;
+   }
+   return a;
+}
+
+// Runs the sort named alg on arr[0..n-1], counting through c
+template <class C>
+void runSort(const string& alg, int arr[], int n, C& c){
+   if (alg == "sort")
+      sorting::sort(arr, n, SortOptions(), c);
+   else if (alg == "quick")
+      quickSort(arr, n, c);
+   else if (alg == "merge")
+      mergeSort(arr, n, c);
+   else if (alg == "heap")
+      heapSort(arr, n, c);
+   else if (alg == "insertion")
+      insertionSort(arr, n, c);
+   else if (alg == "selection")
+      selectionSort(arr, n, nullptr, c);
+   else if (alg == "bubble")
+      bubbleSort(arr, n, c);
+}
+
+// Looks up every key in the sorted arr[0..n-1]; returns how many were found
+long long runSearch(const string& alg, int arr[], int n, const vector<int>& keys){
+   long long found = 0;
+   for (int x : keys)
+      found += ((alg == "binarysearch") ? binarySearch(arr, 0, n - 1, x) : search(arr, n, x)) >= 0;
+   return found;
+}
+
+// Inserts all values in a MinHeap and extracts them; returns false if they do not come out sorted
+bool runHeap(const vector<int>& values){
+   MinHeap h((int)values.size());
+   for (int v : values)
+      h.insertKey(v);
+   int last = INT_MIN;
+   bool ok = true;
+   for (size_t i = 0; i < values.size(); i++){
+      int v = h.extractMin();
+      ok = ok && v >= last;
+      last = v;
+   }
+   return ok;
+}
+
+bool quadratic(const string& alg, const string& dist){
+   if (alg == "insertion" || alg == "selection" || alg == "bubble")
+      return dist != "sorted" || alg == "selection";
+   return false;
+}
+
+struct Result{
+   string algorithm, distribution, status;
+   long long n = 0;
+   int reps = 0;
+   double mean = 0, stddev = 0, best = 0; // ns per element (per lookup for the searches)
+   bool counted = false;                  // comparisons and swaps are only counted for the sorts
+   double comparisons = 0, swaps = 0;     // per element
+};
+
+template <typename F>
+double timeNs(F f){
+   auto start = chrono::steady_clock::now();
+   f();
+   return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+Result measure(const string& alg, const string& dist, int n, int reps, int maxQuadratic, mt19937& gen){
+   Result r;
+   r.algorithm = alg;
+   r.distribution = dist;
+   r.n = n;
+   r.reps = reps;
+   if (n > maxQuadratic && quadratic(alg, dist)){
+      r.status = "skipped";
+      return r;
+   }
+   vector<int> input = makeInput(dist, n, gen);
+   bool isSearch = (alg == "binarysearch" || alg == "search");
+   vector<int> keys;
+   long long ops = n;
+   if (isSearch){
+      std::sort(input.begin(), input.end());
+      // Linear search costs n per lookup: fewer lookups on large arrays
+      long long q = (alg == "search") ? max(1LL, min(1000LL, 100000000LL / max(n, 1))) : 100000;
+      uniform_int_distribution<int> pick(0, max(n - 1, 0));
+      for (long long i = 0; i < q; i++)
+         keys.push_back((i % 2 == 0 && n > 0) ? input[pick(gen)] : (int)gen());
+      ops = q;
+   }
+   if (ops == 0){
+      r.status = "empty";
+      return r;
+   }
+
+   // Checking run
+   bool ok = true;
+   if (isSearch){
+      long long expected = 0;
+      for (int x : keys)
+         expected += binary_search(input.begin(), input.end(), x);
+      ok = runSearch(alg, input.data(), n, keys) == expected;
+   } else if (alg == "minheap"){
+      ok = runHeap(input);
+   } else {
+      vector<int> a = input;
+      Count count;
+      runSort(alg, a.data(), n, count);
+      ok = is_sorted(a.begin(), a.end());
+      r.counted = true;
+      r.comparisons = (double)count.comparisons / n;
+      r.swaps = (double)count.swaps / n;
+   }
+
+   // Timed runs; small inputs are sorted in batches of copies made before the clock starts
+   int batch = isSearch ? 1 : max(1, min(1000, 100000 / max(n, 1)));
+   vector<double> samples;
+   vector<int> copies;
+   long long sink = 0;
+   for (int rep = 0; rep < reps; rep++){
+      double ns;
+      if (isSearch){
+         ns = timeNs([&]{ sink += runSearch(alg, input.data(), n, keys); });
+      } else if (alg == "minheap"){
+         ns = timeNs([&]{ for (int b = 0; b < batch; b++) sink += runHeap(input); });
+      } else {
+         copies.resize((size_t)batch * n);
+         for (int b = 0; b < batch; b++)
+            copy(input.begin(), input.end(), copies.begin() + (size_t)b * n);
+         NoCount plain;
+         ns = timeNs([&]{ for (int b = 0; b < batch; b++) runSort(alg, copies.data() + (size_t)b * n, n, plain); });
+         sink += copies[0];
+      }
+      samples.push_back(ns / ((double)ops * batch));
+   }
+   if (sink == LLONG_MIN) // keeps the results alive
+      cerr << sink;
+   double sum = 0, sq = 0;
+   for (double s : samples)
+      sum += s;
+   r.mean = sum / reps;
+   for (double s : samples)
+      sq += (s - r.mean) * (s - r.mean);
+   r.stddev = (reps > 1) ? sqrt(sq / (reps - 1)) : 0;
+   r.best = *min_element(samples.begin(), samples.end());
+   r.status = ok ? "ok" : "wrong";
+   return r;
+}
+
+// Parses s as a whole decimal integer in [lo, hi]; false if it is not one
+bool parseInteger(const string& s, long long lo, long long hi, long long& value){
+   size_t used = 0;
+   try {
+      value = stoll(s, &used);
+   } catch (const exception&){
+      return false;
+   }
+   return used == s.size() && value >= lo && value <= hi;
+}
+
+vector<string> split(const string& s){
+   vector<string> parts;
+   stringstream in(s);
+   string item;
+   while (getline(in, item, ','))
+      if (!item.empty())
+         parts.push_back(item);
+   return parts;
+}
+
+void printCSV(const vector<Result>& results){
+   cout << "algorithm,distribution,n,reps,mean_ns,stddev_ns,min_ns,comparisons,swaps,status\n";
+   for (const Result& r : results){
+      cout << r.algorithm << "," << r.distribution << "," << r.n << "," << r.reps << "," << r.mean << ","
+           << r.stddev << "," << r.best << ",";
+      if (r.counted)
+         cout << r.comparisons << "," << r.swaps;
+      else
+         cout << ",";
+      cout << "," << r.status << "\n";
+   }
+}
+
+void printJSON(const vector<Result>& results){
+   cout << "[\n";
+   for (size_t i = 0; i < results.size(); i++){
+      const Result& r = results[i];
+      cout << "  {\"algorithm\": \"" << r.algorithm << "\", \"distribution\": \"" << r.distribution
+           << "\", \"n\": " << r.n << ", \"reps\": " << r.reps << ", \"mean_ns\": " << r.mean
+           << ", \"stddev_ns\": " << r.stddev << ", \"min_ns\": " << r.best;
+      if (r.counted)
+         cout << ", \"comparisons\": " << r.comparisons << ", \"swaps\": " << r.swaps;
+      else
+         cout << ", \"comparisons\": null, \"swaps\": null";
+      cout << ", \"status\": \"" << r.status << "\"}" << (i + 1 < results.size() ? ",\n" : "\n");
+   }
+   cout << "]\n";
+}
+
+// Driver Code
+int main(int argc, char** argv){
+   vector<string> algorithms = ALGORITHMS, distributions = DISTRIBUTIONS;
+   vector<int> sizes = { 10, 1000, 100000 };
+   int reps = 5, maxQuadratic = 16384;
+   unsigned seed = 1;
+   string format = "csv";
+   for (int i = 1; i < argc; i += 2){
+      string option = argv[i];
+      if (i + 1 == argc){
+         cerr << "Missing value for " << option << "\n";
+         return 1;
+      }
+      string value = argv[i + 1];
+      long long number = 0;
+      if (option == "--algorithms")
+         algorithms = split(value);
+      else if (option == "--distributions")
+         distributions = split(value);
+      else if (option == "--sizes"){
+         sizes.clear();
+         for (const string& s : split(value)){
+            if (!parseInteger(s, 1, INT_MAX, number)){
+               cerr << "Invalid size " << s << " (an integer from 1 to " << INT_MAX << ")\n";
+               return 1;
+            }
+            sizes.push_back((int)number);
+         }
+      } else if (option == "--reps" || option == "--max-quadratic" || option == "--seed"){
+         long long hi = (option == "--seed") ? UINT_MAX : INT_MAX;
+         if (!parseInteger(value, option == "--reps" ? 1 : 0, hi, number)){
+            cerr << "Invalid value " << value << " for " << option << "\n";
+            return 1;
+         }
+         if (option == "--reps")
+            reps = (int)number;
+         else if (option == "--max-quadratic")
+            maxQuadratic = (int)number;
+         else
+            seed = (unsigned)number;
+      } else if (option == "--format"){
+         if (value != "csv" && value != "json"){
+            cerr << "Unknown format " << value << " (csv or json)\n";
+            return 1;
+         }
+         format = value;
+      } else {
+         cerr << "Unknown option " << option << "\n";
+         return 1;
+      }
+   }
+   for (const string& a : algorithms)
+      if (find(ALGORITHMS.begin(), ALGORITHMS.end(), a) == ALGORITHMS.end()){
+         cerr << "Unknown algorithm " << a << "\n";
+         return 1;
+      }
+   for (const string& d : distributions)
+      if (find(DISTRIBUTIONS.begin(), DISTRIBUTIONS.end(), d) == DISTRIBUTIONS.end()){
+         cerr << "Unknown distribution " << d << "\n";
+         return 1;
+      }
+
+   vector<Result> results;
+   for (const string& a : algorithms)
+      for (const string& d : distributions)
+         for (int n : sizes){
+            mt19937 gen(seed); // the same input for every algorithm
+            results.push_back(measure(a, d, n, reps, maxQuadratic, gen));
+         }
+   if (format == "json")
+      printJSON(results);
+   else
+      printCSV(results);
+   return 0;
+}
@@ -11,35 +11,15 @@ Algorithm:
 
 // Recursive
 #include <iostream>
+#include "BinarySearch.h"
 using namespace std;
-
-// A recursive binary search function.
-// It returns location of x in given array arr[l..r] is present, otherwise -1
-int binarySearch(int arr[], int l, int r, int x){
-   if (r >= l) {
-      int mid = l + (r - l) / 2;
-      // If the element is present at the middle
-      // itself
-      if (arr[mid] == x)
-         return mid;
-      // If element is smaller than mid, then
-      // it can only be present in left subarray
-      if (arr[mid] > x)
-         return binarySearch(arr, l, mid - 1, x);
-      // Else the element can only be present
-      // in right subarray
-      return binarySearch(arr, mid + 1, r, x);
-    }
-    // We reach here when element is not
-    // present in array
-    return -1;
-}
+using namespace sorting;
 
 int main(void){
    int arr[] = { 2, 3, 4, 10, 40 };
    int x = 10;
    int n = sizeof(arr) / sizeof(arr[0]);
-   int result = binarySearch(arr, 0, n - 1, x);
+   int result = binarySearchRecursive(arr, 0, n - 1, x);
    (result == -1) ? cout << "Element is not present in array"
                    : cout << "Element is present at index " << result;
    return 0;
@@ -48,34 +28,83 @@ int main(void){
 
 // Iterative
 #include <iostream>
+#include "BinarySearch.h"
 using namespace std;
-
-// A iterative binary search function.
-// It returns location of x in given array arr[l..r] if present, otherwise -1
-int binarySearch(int arr[], int l, int r, int x){
-   while (l <= r) {
-      int m = l + (r - l) / 2;
-      // Check if x is present at mid
-      if (arr[m] == x)
-         return m;
-      // If x greater, ignore left half
-      if (arr[m] < x) 
-         l = m + 1;
-       // If x is smaller, ignore right half
-       else
-         r = m - 1;
-    }
-   // if we reach here, then element was
-   // not present
-   return -1;
-}
+using namespace sorting;
 
 int main(void){
    int arr[] = { 2, 3, 4, 10, 40 };
    int x = 10;
    int n = sizeof(arr) / sizeof(arr[0]);
-   int result = binarySearch(arr, 0, n - 1, x);
+   long long result = binarySearch(arr, 0, n - 1, x);
    (result == -1) ? cout << "Element is not present in array"
                    : cout << "Element is present at index " << result;
    return 0;
 }
+
+
+/* Memory-Mapped Binary Search
+Large sorted key files do not have to be read into an array before searching them.
+The file is mapped into memory with mmap() and binarySearch() runs directly on the mapping;
+the operating system reads only the pages that the search actually touches.
+
+File format: n keys stored as raw int values (native byte order), sorted in increasing order.
+
+Algorithm:
+1. Open: mmap() the whole file read-only and madvise(MADV_RANDOM) so the kernel does not read ahead
+   around every probe. Nothing is read, so opening costs the same for any file size.
+2. Without an index a lookup is a plain binary search over the mapping: about log2(n / keys per page) page faults.
+3. Optional sparse index: keep every Nth key in a small array in RAM (buildIndex).
+   A lookup binary searches the index to pick one block, then binary searches inside that block,
+   so it touches about log2(N / keys per page) + 1 pages of the file.
+   Building the index reads one page per block. By default N is chosen (a whole number of pages) so that the index
+   has at most INDEX_KEYS entries: building it costs a fixed number of page faults whatever the file size,
+   and saves the top levels of every search. A smaller N (down to one key per page, 1 fault per lookup)
+   only pays off when many lookups follow, since the build then reads every page of the file.
+
+Example: 10^9 keys (4 GB, 4 KB pages): no index -> about 20 page faults per lookup;
+default index of 4096 keys (16 KB, built with 4096 page faults) -> about 9 per lookup;
+N = 1024 -> index of about 10^6 keys (4 MB, every page read to build it), 1 per lookup.
+
+Time Complexity:
+Best: Ω(1)
+Average: θ(log(n))
+Worst: O(log(n))
+*/
+
+#include <iostream>
+#include <cstdio>
+#include "BinarySearch.h"
+using namespace std;
+using namespace sorting;
+
+// Driver code
+int main(void){
+   const char *path = "sorted_keys.bin";
+   // Write 1,000,000 sorted keys: 0, 2, 4, ...
+   FILE *f = fopen(path, "wb");
+   if (f == NULL){
+      perror(path);
+      return 1;
+   }
+   for (int i = 0; i < 1000000; i++){
+      int key = 2 * i;
+      fwrite(&key, sizeof(key), 1, f);
+   }
+   fclose(f);
+
+   MappedKeys m;
+   if (!openKeys(path, m))
+      return 1;
+   int x = 123456;
+   long long result = mappedSearch(m, x);
+   buildIndex(m, 0);
+   long long indexed = mappedSearch(m, x);
+   (result == -1) ? cout << "Element is not present in file"
+                  : cout << "Element is present at index " << result;
+   cout << "\nWith a sparse index of " << m.index.size() << " keys: " << indexed;
+   cout << "\nSearching 123457: " << mappedSearch(m, 123457) << endl;
+   closeKeys(m);
+   remove(path);
+   return 0;
+}
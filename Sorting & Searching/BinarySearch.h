@@ -0,0 +1,151 @@
+/* Binary Search (Binary Search.cpp describes each version):
+binarySearch(), binarySearchRecursive() - on a sorted array
+openKeys(), buildIndex(), mappedSearch() - on a sorted key file mapped into memory, with an optional sparse index
+*/
+
+#ifndef BINARY_SEARCH_H
+#define BINARY_SEARCH_H
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sorting {
+
+// A recursive binary search function.
+// It returns location of x in given array arr[l..r] is present, otherwise -1
+inline int binarySearchRecursive(const int arr[], int l, int r, int x){
+   if (r >= l) {
+      int mid = l + (r - l) / 2;
+      // If the element is present at the middle
+      // itself
+      if (arr[mid] == x)
+         return mid;
+      // If element is smaller than mid, then
+      // it can only be present in left subarray
+      if (arr[mid] > x)
+         return binarySearchRecursive(arr, l, mid - 1, x);
+      // Else the element can only be present
+      // in right subarray
+      return binarySearchRecursive(arr, mid + 1, r, x);
+   }
+   // We reach here when element is not
+   // present in array
+   return -1;
+}
+
+// A iterative binary search function.
+// It returns location of x in given array arr[l..r] if present, otherwise -1
+inline long long binarySearch(const int arr[], long long l, long long r, int x){
+   while (l <= r){
+      long long m = l + (r - l) / 2;
+      // Check if x is present at mid
+      if (arr[m] == x)
+         return m;
+      // If x greater, ignore left half
+      if (arr[m] < x)
+         l = m + 1;
+      // If x is smaller, ignore right half
+      else
+         r = m - 1;
+   }
+   // if we reach here, then element was
+   // not present
+   return -1;
+}
+
+const long long INDEX_KEYS = 4096; // default maximum size of the sparse index
+
+// A read-only sorted key file mapped into memory
+struct MappedKeys{
+   const int *keys = NULL; // the mapping, viewed as an array
+   long long n = 0;        // number of keys
+   size_t bytes = 0;       // size of the mapping
+   std::vector<int> index; // index[b] = keys[b * stride]
+   long long stride = 0;   // keys per index block
+};
+
+// Maps the file at path. Returns false if it cannot be opened or is not a whole number of keys.
+inline bool openKeys(const char *path, MappedKeys &m){
+   int fd = open(path, O_RDONLY);
+   if (fd < 0){
+      perror(path);
+      return false;
+   }
+   struct stat st;
+   if (fstat(fd, &st) != 0 || st.st_size % sizeof(int) != 0){
+      std::cout << path << ": not a file of int keys\n";
+      close(fd);
+      return false;
+   }
+   m.bytes = st.st_size;
+   m.n = st.st_size / sizeof(int);
+   m.index.clear();
+   m.stride = 0;
+   if (m.bytes == 0){
+      close(fd);
+      m.keys = NULL;
+      return true;
+   }
+   void *p = mmap(NULL, m.bytes, PROT_READ, MAP_SHARED, fd, 0);
+   // The mapping stays valid after the descriptor is closed
+   close(fd);
+   if (p == MAP_FAILED){
+      perror("mmap");
+      return false;
+   }
+   madvise(p, m.bytes, MADV_RANDOM);
+   m.keys = (const int *)p;
+   return true;
+}
+
+inline void closeKeys(MappedKeys &m){
+   if (m.keys != NULL)
+      munmap((void *)m.keys, m.bytes);
+   m.keys = NULL;
+   m.n = 0;
+   m.bytes = 0;
+   m.index.clear();
+}
+
+// Samples every stride-th key into m.index. stride <= 0 picks a whole number of pages per entry
+// so that the index has at most INDEX_KEYS entries.
+inline void buildIndex(MappedKeys &m, long long stride){
+   if (stride <= 0){
+      long long pageKeys = sysconf(_SC_PAGESIZE) / sizeof(int);
+      long long pages = (m.n + pageKeys - 1) / pageKeys;
+      stride = std::max(1LL, (pages + INDEX_KEYS - 1) / INDEX_KEYS) * pageKeys;
+   }
+   m.stride = stride;
+   m.index.clear();
+   if (m.n == 0)
+      return;
+   // One key per block, read under MADV_RANDOM: no read-ahead of the pages in between
+   m.index.reserve((m.n + stride - 1) / stride);
+   for (long long i = 0; i < m.n; i += stride)
+      m.index.push_back(m.keys[i]);
+}
+
+// Returns location of x in the mapped file if present, otherwise -1
+inline long long mappedSearch(const MappedKeys &m, int x){
+   if (m.n == 0)
+      return -1;
+   if (m.index.empty())
+      return binarySearch(m.keys, 0, m.n - 1, x);
+   // Last block whose first key is <= x
+   long long b = std::upper_bound(m.index.begin(), m.index.end(), x) - m.index.begin() - 1;
+   if (b < 0)
+      return -1;
+   long long l = b * m.stride;
+   long long r = std::min(l + m.stride, m.n) - 1;
+   return binarySearch(m.keys, l, r, x);
+}
+
+} // namespace sorting
+
+#endif
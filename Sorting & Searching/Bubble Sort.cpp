@@ -26,6 +26,7 @@ Third Pass:
 Optimized Implementation:
 The above function always runs O(n^2) time even if the array is sorted.
 It can be optimized by stopping the algorithm if inner loop didn’t cause any swap.
+The code is bubbleSort() in BubbleSort.h, which also stops after a pass without swaps.
 
 Time Complexity:
 Best: Ω(n)
@@ -34,33 +35,9 @@ Worst: O(n^2)
 */
 
 #include <iostream>
+#include "BubbleSort.h"
 using namespace std;
-
-void swap(int *x, int *y){
-   int temp = *x;
-   *x = *y;
-   *y = temp;
-}
-
-// A function to implement bubble sort
-void bubbleSort(int arr[], int n){
-   int i, j;
-   bool swapped;
-   for (i = 0; i < n-1; i++){
-      swapped = false;
-   // Last i elements are already in place
-      for (j = 0; j < n-i-1; j++){
-         if (arr[j] > arr[j+1]){
-            swap(&arr[j], &arr[j+1]);
-            swapped = true;
-         }
-      }
-      // Optimized : If inner loop didn't cause any swap
-      if (swapped == false){
-         break;
-      }
-    }
-}
+using namespace sorting;
 
 // Function to print an array
 void printArray(int arr[], int size){
@@ -92,24 +69,13 @@ Recursion Idea:
 If array size is 1, return.
 Do one pass of Bubble Sort. This pass fixes last element of current subarray.
 Recur for all elements except last of current subarray.
+The code is bubbleSortRecursive() in BubbleSort.h.
 */
 
 #include <iostream>
+#include "BubbleSort.h"
 using namespace std;
-
-// A function to implement bubble sort
-void bubbleSort(int arr[], int n){
-   // If array size is 1, return.
-   if (n == 1)
-       return;
-   // Do one pass of Bubble Sort.
-   // After this pass, the largest element is moved to end.
-   for (int i=0; i<n-1; i++)
-      if (arr[i] > arr[i+1])
-         swap(arr[i], arr[i+1]);
-    // Largest element is fixed, recur for remaining array
-    bubbleSort(arr, n-1);
-}
+using namespace sorting;
 
 /* Function to print an array */
 void printArray(int arr[], int n){
@@ -122,8 +88,103 @@ void printArray(int arr[], int n){
 int main(){
    int arr[] = {64, 34, 25, 12, 22, 11, 90};
    int n = sizeof(arr)/sizeof(arr[0]);
-   bubbleSort(arr, n);
+   bubbleSortRecursive(arr, n);
    cout << "Sorted array: \n";
    printArray(arr, n);
    return 0;
 }
+
+
+/* Odd-Even Transposition Sort and Cocktail Shaker Sort
+Both keep the idea of Bubble Sort (only adjacent elements are compared and swapped) but change the order of the comparisons.
+
+Odd-Even Transposition Sort:
+Even phase: compare and swap the pairs (0,1), (2,3), (4,5), ...
+Odd phase:  compare and swap the pairs (1,2), (3,4), (5,6), ...
+The pairs of one phase do not overlap, so they can all be done at the same time:
+the phase is split between threads and the threads wait for each other (barrier) before the next phase.
+Each compare and swap is written without a branch (min to the left, max to the right).
+n phases always sort the array; as in the optimized bubbleSort(), it stops early
+when an even and an odd phase in a row made no swap.
+
+Example:
+( 5 1 4 2 8 ) even phase –> ( 1 5 2 4 8 )
+( 1 5 2 4 8 ) odd phase  –> ( 1 2 5 4 8 )
+( 1 2 5 4 8 ) even phase –> ( 1 2 4 5 8 )
+( 1 2 4 5 8 ) odd phase and even phase: no swap, stop.
+
+Cocktail Shaker Sort:
+Passes go alternately left to right (moving the largest element to the end) and right to left (moving the smallest to the front).
+After each pass, everything beyond the last swap is already in place, so the next pass stops there.
+A small element near the end of an almost sorted array needs only one backward pass,
+while bubbleSort() moves it one position per pass. On nearly sorted data it ends after a few passes.
+
+Time Complexity:
+Odd-even: Best: Ω(n), Average: θ(n^2 / P) with P threads, Worst: O(n^2 / P)
+Cocktail: Best: Ω(n), Average: θ(n^2), Worst: O(n^2)
+*/
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "BubbleSort.h"
+using namespace std;
+using namespace sorting;
+
+// Function to print an array
+void printArray(int arr[], int size){
+   for (int i = 0; i < size; i++)
+      cout << arr[i] << " ";
+   cout << endl;
+}
+
+template <typename F>
+double timeMs(F f){
+   auto start = chrono::steady_clock::now();
+   f();
+   return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// Driver code
+int main(){
+   int arr[] = {64, 34, 25, 12, 22, 11, 90};
+   int arr2[] = {64, 34, 25, 12, 22, 11, 90};
+   int n = sizeof(arr)/sizeof(arr[0]);
+   oddEvenSort(arr, n, 2);
+   cocktailSort(arr2, n);
+   cout << "Sorted array (odd-even): \n";
+   printArray(arr, n);
+   cout << "Sorted array (cocktail): \n";
+   printArray(arr2, n);
+
+   // Small, almost sorted buffers: 64 elements with the last one out of place
+   mt19937 gen(1);
+   const int BUFFERS = 20000, SIZE = 64;
+   vector<int> base(BUFFERS * SIZE);
+   for (int b = 0; b < BUFFERS; b++){
+      for (int i = 0; i < SIZE; i++)
+         base[b * SIZE + i] = i * 10;
+      base[b * SIZE + SIZE - 1] = (int)(gen() % (SIZE * 10));
+   }
+   vector<int> x = base, y = base;
+   double bubbleMs = timeMs([&]{ for (int b = 0; b < BUFFERS; b++) bubbleSort(&x[b * SIZE], SIZE); });
+   double cocktailMs = timeMs([&]{ for (int b = 0; b < BUFFERS; b++) cocktailSort(&y[b * SIZE], SIZE); });
+   cout << BUFFERS << " almost sorted buffers of " << SIZE << ": bubble " << bubbleMs << " ms, cocktail "
+        << cocktailMs << " ms" << (x == y ? "" : " (results differ!)") << endl;
+
+   // Random data: bubble sort against odd-even transposition with 1 and all threads
+   const int N = 20000;
+   int threads = max(1u, thread::hardware_concurrency());
+   vector<int> data(N);
+   for (int& v : data)
+      v = (int)(gen() % 1000000);
+   vector<int> a = data, b = data, c = data;
+   double t1 = timeMs([&]{ bubbleSort(a.data(), N); });
+   double t2 = timeMs([&]{ oddEvenSort(b.data(), N, 1); });
+   double t3 = timeMs([&]{ oddEvenSort(c.data(), N, threads); });
+   cout << N << " random elements: bubble " << t1 << " ms, odd-even " << t2 << " ms, odd-even with "
+        << threads << " threads " << t3 << " ms" << (a == b && b == c ? "" : " (results differ!)") << endl;
+   return 0;
+}
@@ -0,0 +1,153 @@
+/* Bubble Sort and the sorts that keep its adjacent compare and swap (Bubble Sort.cpp describes each one):
+bubbleSort()   - the optimized version, stops after a pass without swaps
+bubbleSortRecursive() - the plain passes written recursively
+oddEvenSort()  - odd-even transposition sort, the pairs of each phase split between threads
+cocktailSort() - cocktail shaker sort, passes in both directions
+*/
+
+#ifndef BUBBLE_SORT_H
+#define BUBBLE_SORT_H
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include "Counter.h"
+
+namespace sorting {
+
+// An optimized version of Bubble Sort
+template <class C>
+inline void bubbleSort(int arr[], int n, C& c){
+   for (int i = 0; i < n - 1; i++){
+      bool swapped = false;
+      for (int j = 0; j < n - i - 1; j++){
+         if (c.less(arr[j + 1], arr[j])){
+            c.exchange(arr[j], arr[j + 1]);
+            swapped = true;
+         }
+      }
+      // If no two elements were swapped by inner loop, then break
+      if (!swapped)
+         break;
+   }
+}
+
+inline void bubbleSort(int arr[], int n){
+   NoCount c;
+   bubbleSort(arr, n, c);
+}
+
+// One pass moves the largest element to the end, then recur for the rest
+inline void bubbleSortRecursive(int arr[], int n){
+   if (n <= 1)
+      return;
+   for (int i = 0; i < n - 1; i++)
+      if (arr[i] > arr[i + 1])
+         std::swap(arr[i], arr[i + 1]);
+   bubbleSortRecursive(arr, n - 1);
+}
+
+// Threads wait in wait() until all of them have arrived
+class Barrier{
+   int threads;
+   std::atomic<int> arrived{0};
+   std::atomic<int> generation{0};
+public:
+   explicit Barrier(int threads) : threads(threads) {}
+   void wait(){
+      int gen = generation.load();
+      if (arrived.fetch_add(1) + 1 == threads){
+         arrived.store(0);
+         generation.fetch_add(1);
+      } else {
+         while (generation.load() == gen)
+            std::this_thread::yield();
+      }
+   }
+};
+
+// Compares and swaps the pairs first, first+2, ... (pair k starts at first + 2k) for k in [from, to)
+inline bool transpose(int arr[], int first, int from, int to){
+   bool swapped = false;
+   for (int k = from; k < to; k++){
+      int i = first + 2 * k;
+      int a = arr[i], b = arr[i + 1];
+      arr[i] = std::min(a, b);
+      arr[i + 1] = std::max(a, b);
+      swapped |= a > b;
+   }
+   return swapped;
+}
+
+// Odd-even transposition sort with the phases split between the given number of threads
+inline void oddEvenSort(int arr[], int n, int threads){
+   if (n < 2)
+      return;
+   threads = std::max(1, std::min(threads, n / 2));
+   if (threads == 1){
+      bool last = true;
+      for (int p = 0; p < n; p++){
+         bool swapped = transpose(arr, p % 2, 0, (n - p % 2) / 2);
+         if (!swapped && !last)
+            break;
+         last = swapped;
+      }
+      return;
+   }
+   Barrier barrier(threads);
+   // swapped[p % 4]: some thread swapped in phase p.
+   // Slot p+1 is cleared during phase p; its last readers passed the barrier of phase p-1 already.
+   std::atomic<bool> swapped[4] = { {false}, {false}, {false}, {false} };
+   auto worker = [&](int t){
+      for (int p = 0; p < n; p++){
+         int pairs = (n - p % 2) / 2;
+         if (t == 0)
+            swapped[(p + 1) % 4].store(false);
+         if (transpose(arr, p % 2, (long long)pairs * t / threads, (long long)pairs * (t + 1) / threads))
+            swapped[p % 4].store(true);
+         barrier.wait();
+         if (p > 0 && !swapped[p % 4].load() && !swapped[(p + 3) % 4].load())
+            break; // every thread sees the same flags and stops at the same phase
+      }
+   };
+   std::vector<std::thread> pool;
+   for (int t = 1; t < threads; t++)
+      pool.emplace_back(worker, t);
+   worker(0);
+   for (std::thread& th : pool)
+      th.join();
+}
+
+// Cocktail shaker sort, stops when a pass makes no swap
+inline void cocktailSort(int arr[], int n){
+   int start = 0, end = n - 1;
+   while (start < end){
+      // Left to right: the largest element goes to end
+      int lastSwap = -1;
+      for (int i = start; i < end; i++){
+         if (arr[i] > arr[i + 1]){
+            std::swap(arr[i], arr[i + 1]);
+            lastSwap = i;
+         }
+      }
+      if (lastSwap < 0)
+         break;
+      end = lastSwap;
+      // Right to left: the smallest element goes to start
+      lastSwap = -1;
+      for (int i = end; i > start; i--){
+         if (arr[i - 1] > arr[i]){
+            std::swap(arr[i - 1], arr[i]);
+            lastSwap = i;
+         }
+      }
+      if (lastSwap < 0)
+         break;
+      start = lastSwap;
+   }
+}
+
+} // namespace sorting
+
+#endif
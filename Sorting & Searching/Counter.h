@@ -0,0 +1,33 @@
+/* Counter policies for the sorts of this folder: every sort takes one as its last argument
+(sorting::quickSort(arr, n, counter)) and does its comparisons and swaps through it.
+NoCount - the plain operations, compiled to exactly the code without a counter; the sorts without one use it
+Count   - the same operations, counted (Benchmark.cpp reports them per element)
+A single element moved (insertion sort shifting, merge sort copying back) counts as one swap.
+*/
+
+#ifndef COUNTER_H
+#define COUNTER_H
+
+#include <utility>
+
+namespace sorting {
+
+// Plain operations
+struct NoCount{
+   bool less(int a, int b) { return a < b; }
+   void exchange(int& a, int& b) { std::swap(a, b); }
+   void moved() {}
+};
+
+// The same operations, counted
+struct Count{
+   long long comparisons = 0;
+   long long swaps = 0;
+   bool less(int a, int b) { comparisons++; return a < b; }
+   void exchange(int& a, int& b) { swaps++; std::swap(a, b); }
+   void moved() { swaps++; }
+};
+
+} // namespace sorting
+
+#endif
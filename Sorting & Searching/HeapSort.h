@@ -0,0 +1,51 @@
+/* Heap Sort, as used by sort() and by the Quick Sort fallback (Heap Sort.cpp describes the algorithm);
+heapify() sifts down iteratively instead of recursing.
+*/
+
+#ifndef HEAP_SORT_H
+#define HEAP_SORT_H
+
+#include "Counter.h"
+
+namespace sorting {
+
+// To heapify a subtree rooted with node i which is an index in arr[], n is size of heap
+template <class C>
+inline void heapify(int arr[], int n, int i, C& c){
+   while (true){
+      int largest = i;
+      int l = 2*i + 1, r = 2*i + 2;
+      if (l < n && c.less(arr[largest], arr[l]))
+         largest = l;
+      if (r < n && c.less(arr[largest], arr[r]))
+         largest = r;
+      if (largest == i)
+         return;
+      c.exchange(arr[i], arr[largest]);
+      i = largest;
+   }
+}
+
+template <class C>
+inline void heapSort(int arr[], int n, C& c){
+   for (int i = n / 2 - 1; i >= 0; i--)
+      heapify(arr, n, i, c);
+   for (int i = n - 1; i > 0; i--){
+      c.exchange(arr[0], arr[i]);
+      heapify(arr, i, 0, c);
+   }
+}
+
+inline void heapify(int arr[], int n, int i){
+   NoCount c;
+   heapify(arr, n, i, c);
+}
+
+inline void heapSort(int arr[], int n){
+   NoCount c;
+   heapSort(arr, n, c);
+}
+
+} // namespace sorting
+
+#endif
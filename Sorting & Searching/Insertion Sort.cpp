@@ -26,6 +26,7 @@ i = 3. 5 will move to the beginning and all other elements from 11 to 13 will mo
 
 i = 4. 6 will move to position after 5, and elements from 11 to 13 will move one position ahead of their current position.
 5, 6, 11, 12, 13
+The code is insertionSort() in InsertionSort.h, shared with the other sorts of this folder.
 
 Time Complexity:
 Best: Ω(n)
@@ -34,24 +35,9 @@ Worst: O(n^2)
 */
 
 #include <iostream>
+#include "InsertionSort.h"
 using namespace std;
-
-// Function to sort an array using insertion sort
-void insertionSort(int arr[], int n){
-   int i, key, j;
-   for (i = 1; i < n; i++){
-      key = arr[i];
-      j = i - 1;
-      /* Move elements of arr[0..i-1], that are
-      greater than key, to one position ahead
-      of their current position */
-      while (j >= 0 && arr[j] > key){
-         arr[j + 1] = arr[j];
-         j = j - 1;
-      }
-      arr[j + 1] = key;
-    }
-}
+using namespace sorting;
 
 // A utility function to print an array of size n
 void printArray(int arr[], int n){
@@ -80,30 +66,13 @@ Recursion Idea:
 If array size is 1 or smaller, return.
 Recursively sort first n-1 elements.
 Insert last element at its correct position in sorted array.
+The code is insertionSortRecursive() in InsertionSort.h.
 */
 
 #include <iostream>
+#include "InsertionSort.h"
 using namespace std;
-  
-// Recursive function to sort an array using insertion sort
-void insertionSortRecursive(int arr[], int n){
-   // Base case
-   if (n <= 1)
-      return;
-   // Sort first n-1 elements
-   insertionSortRecursive( arr, n-1 );
-   // Insert last element at its correct position in sorted array.
-   int last = arr[n-1];
-   int j = n-2;
-   /* Move elements of arr[0..i-1], that are
-   greater than key, to one position ahead
-   of their current position */
-   while (j >= 0 && arr[j] > last){
-      arr[j+1] = arr[j];
-      j--;
-   }
-   arr[j+1] = last;
-}
+using namespace sorting;
 
 // A utility function to print an array of size n
 void printArray(int arr[], int n){
@@ -119,3 +88,174 @@ int main(){
    printArray(arr, n);
    return 0;
 }
+
+
+/* Binary Insertion Sort
+Insertion sort spends its time in two places: finding where the key goes (linear scan, O(i) comparisons)
+and moving the greater elements one position up (O(i) single moves).
+Both can be done better:
+1. The prefix arr[0..i-1] is sorted, so the position can be found with a binary search in O(log(i)) comparisons.
+2. The greater elements form one contiguous block, so they can be moved with a single memmove(),
+   which copies whole cache lines instead of one int per loop iteration.
+
+The same step keeps an array sorted while items arrive one at a time (SortedArray below):
+each insert is one binary search plus one memmove of the tail.
+
+Example:
+Sorted part: 5, 11, 12, 13    key: 6
+Binary search: first element greater than 6 is 11 at index 1
+memmove 11, 12, 13 one position up, store 6 at index 1
+5, 6, 11, 12, 13
+
+Time Complexity:
+Best: Ω(n)
+Average: θ(n^2) moves (as one memmove per element), θ(n log(n)) comparisons
+Worst: O(n^2)
+*/
+
+#include <iostream>
+#include "InsertionSort.h"
+using namespace std;
+using namespace sorting;
+
+// A utility function to print an array of size n
+void printArray(int arr[], int n){
+   for (int i = 0; i < n; i++)
+      cout << arr[i] << " ";
+   cout << endl;
+}
+
+// Driver code
+int main(){
+   int arr[] = { 12, 11, 13, 5, 6 };
+   int n = sizeof(arr) / sizeof(arr[0]);
+   binaryInsertionSort(arr, n);
+   printArray(arr, n);
+
+   SortedArray s(2);
+   for (int i = 0; i < n; i++)
+      s.insert(arr[n - 1 - i] * 3 % 17);
+   for (int i = 0; i < s.getSize(); i++)
+      cout << s.get(i) << " ";
+   cout << "\n15 is at index " << s.find(15) << endl;
+   return 0;
+}
+
+
+/* Packed Memory Array (gapped insertion)
+In a plain sorted array every insert moves the whole tail, O(n) elements.
+A Packed Memory Array keeps gaps spread through the array, so an insert only moves a small window.
+
+Layout:
+The array of capacity slots is cut into segments of S slots (S about log2(capacity)).
+Each segment keeps its elements sorted and packed at its start, followed by free slots;
+cnt[s] is the number of elements in segment s.
+Taken in segment order, the elements form one sorted sequence.
+
+Algorithm for insert(key):
+1. Binary search the segments by their first element to find the segment that must hold key.
+2. If it has a free slot, insert with binary search + memmove inside the segment (at most S moves).
+3. Otherwise look at the enclosing windows of 2, 4, 8, ... segments until one is dense enough:
+   a window at height h of H may be at most 1 - h/(4H) full, i.e. 100% at the leaves down to 75% for the whole array.
+   Spread the window's elements (plus key) evenly over its segments.
+4. If even the whole array is too full, double the capacity and spread everything.
+
+Windows near the leaves are small and rebalanced often, big windows are rebalanced rarely,
+so the amortized cost is O(log^2(n)) element moves per insert, and each insert touches a contiguous window.
+
+Time Complexity:
+Search: O(log(n))
+Insert: O(log^2(n)) amortized moves
+Iteration: O(n), in sorted order
+*/
+
+#include <iostream>
+#include "InsertionSort.h"
+using namespace std;
+using namespace sorting;
+
+// Driver code
+int main(){
+   GappedSortedArray g;
+   for (int i = 0; i < 20; i++)
+      g.insert(i * 7 % 20);
+   int out[20];
+   g.toArray(out);
+   for (int i = 0; i < g.getSize(); i++)
+      cout << out[i] << " ";
+   cout << "\nContains 13: " << g.contains(13) << ", contains 25: " << g.contains(25) << endl;
+   return 0;
+}
+
+
+/* Shell Sort
+Insertion sort is fast on small or nearly sorted arrays but moves an element only one position per step,
+so it becomes quadratic as the array grows. Shell sort runs the same insertion kernel with a gap:
+first it sorts elements that are far apart (gap h), then closer ones, and finishes with gap 1, which is plain insertion sort.
+By then the array is almost sorted and the last pass is close to linear.
+
+Algorithm:
+1. Pick a decreasing gap sequence ending with 1.
+2. For each gap h: for i = h to n-1, insert arr[i] into the sorted chain arr[i-h], arr[i-2h], ...
+   (the insertion sort inner loop with j -= h instead of j -= 1).
+
+Gap sequences:
+Ciura:  1, 4, 10, 23, 57, 132, 301, 701, then about 2.25 times the previous gap (best known, found experimentally)
+Tokuda: h(k) = ceil((9 * (9/4)^k - 4) / 5) = 1, 4, 9, 20, 46, 103, 233, 525, ...
+
+The driver sweeps array sizes and prints, as CSV, the nanoseconds per element of insertion sort, both Shell sorts
+and quickSort() of QuickSort.h (which itself leaves ranges of up to SMALL elements to insertion sort),
+so the cutover points for hybrid sorts can be read off for the machine at hand.
+
+Time Complexity (no tight bound is known for these sequences):
+Best: Ω(n log(n))
+Average: about n^1.25 measured
+Worst: O(n^1.5) or better
+*/
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "InsertionSort.h"
+#include "QuickSort.h"
+using namespace std;
+using namespace sorting;
+
+// Sorts copies of random batches of size n and returns nanoseconds per element
+template <typename Sort>
+double timePerElement(int n, Sort sort){
+   mt19937 gen(n);
+   int batches = max(1, 2000000 / n / max(1, n / 256)); // fewer batches where the sort is slower
+   vector<int> input((size_t)n * batches), work(n);
+   for (auto& v : input)
+      v = (int)gen();
+   auto start = chrono::steady_clock::now();
+   for (int b = 0; b < batches; b++){
+      copy(input.begin() + (size_t)b * n, input.begin() + (size_t)(b + 1) * n, work.begin());
+      sort(work.data(), n);
+   }
+   double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+   return ns / ((double)n * batches);
+}
+
+// Driver code
+int main(){
+   int arr[] = { 12, 11, 13, 5, 6, 40, 1, 8 };
+   int n = sizeof(arr) / sizeof(arr[0]);
+   shellSort(arr, n, CIURA);
+   for (int i = 0; i < n; i++)
+      cout << arr[i] << " ";
+   cout << "\n\n";
+
+   // Size sweep, CSV: pick the cutover where the next column becomes faster
+   cout << "n,insertion_ns,shell_ciura_ns,shell_tokuda_ns,quick_ns\n";
+   for (int size : { 8, 16, 32, 64, 100, 250, 500, 1000, 2500, 5000, 10000 }){
+      cout << size << ","
+           << timePerElement(size, [](int a[], int m){ insertionSort(a, m); }) << ","
+           << timePerElement(size, [](int a[], int m){ shellSort(a, m, CIURA); }) << ","
+           << timePerElement(size, [](int a[], int m){ shellSort(a, m, TOKUDA); }) << ","
+           << timePerElement(size, [](int a[], int m){ quickSort(a, m); }) << "\n";
+   }
+   return 0;
+}
@@ -0,0 +1,327 @@
+/* Insertion Sort and the sorts built on it (Insertion Sort.cpp describes each one):
+insertionSort()        - the plain algorithm, and a version that gives up after a number of moves
+insertionSortRecursive() - the same steps written recursively
+binaryInsertionSort()  - binary search for the position, one memmove for the greater elements
+SortedArray            - a growable array kept sorted with the same step
+GappedSortedArray      - Packed Memory Array, gaps between the elements so an insert moves a small window
+shellSort()            - insertion sort with decreasing gaps (Ciura or Tokuda)
+*/
+
+#ifndef INSERTION_SORT_H
+#define INSERTION_SORT_H
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "Counter.h"
+
+namespace sorting {
+
+const int SMALL = 32; // up to this size insertion sort is the fastest; the other sorts finish with it
+
+// Function to sort an array using insertion sort
+template <class C>
+inline void insertionSort(int arr[], int n, C& c){
+   for (int i = 1; i < n; i++){
+      int key = arr[i];
+      int j = i - 1;
+      while (j >= 0 && c.less(key, arr[j])){
+         arr[j + 1] = arr[j];
+         c.moved();
+         j = j - 1;
+      }
+      arr[j + 1] = key;
+   }
+}
+
+inline void insertionSort(int arr[], int n){
+   NoCount c;
+   insertionSort(arr, n, c);
+}
+
+// Recursive function to sort an array using insertion sort
+inline void insertionSortRecursive(int arr[], int n){
+   if (n <= 1)
+      return;
+   // Sort first n-1 elements, then insert the last one
+   insertionSortRecursive(arr, n - 1);
+   int last = arr[n - 1];
+   int j = n - 2;
+   while (j >= 0 && arr[j] > last){
+      arr[j + 1] = arr[j];
+      j--;
+   }
+   arr[j + 1] = last;
+}
+
+// Insertion sort that stops once it has moved more than moves elements; returns false if it stopped
+// (arr is then partly sorted, with the same elements)
+template <class C>
+inline bool insertionSort(int arr[], int n, long long moves, C& c){
+   for (int i = 1; i < n; i++){
+      int key = arr[i];
+      int j = i - 1;
+      while (j >= 0 && c.less(key, arr[j])){
+         arr[j + 1] = arr[j];
+         c.moved();
+         j = j - 1;
+      }
+      arr[j + 1] = key;
+      moves -= i - 1 - j;
+      if (moves < 0)
+         return false;
+   }
+   return true;
+}
+
+inline bool insertionSort(int arr[], int n, long long moves){
+   NoCount c;
+   return insertionSort(arr, n, moves, c);
+}
+
+// Returns the index of the first element of arr[0..n-1] greater than key,
+// so equal keys keep their order (the sort stays stable)
+inline int upperBound(const int arr[], int n, int key){
+   int l = 0, r = n;
+   while (l < r){
+      int m = l + (r - l) / 2;
+      if (arr[m] <= key)
+         l = m + 1;
+      else
+         r = m;
+   }
+   return l;
+}
+
+// Function to sort an array using binary insertion sort
+inline void binaryInsertionSort(int arr[], int n){
+   for (int i = 1; i < n; i++){
+      int key = arr[i];
+      // Already in place: no search, no move
+      if (arr[i - 1] <= key)
+         continue;
+      int pos = upperBound(arr, i, key);
+      memmove(&arr[pos + 1], &arr[pos], (i - pos) * sizeof(int));
+      arr[pos] = key;
+   }
+}
+
+// A growable array that stays sorted as items are inserted
+class SortedArray{
+   int *arr; // pointer to array of elements
+   int capacity; // allocated size of arr
+   int size; // current number of elements
+public:
+    // Constructor
+    SortedArray(int cap = 16);
+    ~SortedArray() { delete[] arr; }
+    SortedArray(const SortedArray&) = delete;
+    SortedArray& operator=(const SortedArray&) = delete;
+    // Inserts a new key, keeping the elements sorted
+    void insert(int key);
+    // Returns location of key if present, otherwise -1
+    int find(int key) const;
+    int getSize() const { return size; }
+    int get(int i) const { return arr[i]; }
+};
+
+inline SortedArray::SortedArray(int cap){
+   capacity = cap > 0 ? cap : 1;
+   size = 0;
+   arr = new int[capacity];
+}
+
+inline void SortedArray::insert(int key){
+   if (size == capacity){
+      // Double the storage so appends stay amortized O(1)
+      int *bigger = new int[2 * capacity];
+      memcpy(bigger, arr, size * sizeof(int));
+      delete[] arr;
+      arr = bigger;
+      capacity *= 2;
+   }
+   int pos = upperBound(arr, size, key);
+   memmove(&arr[pos + 1], &arr[pos], (size - pos) * sizeof(int));
+   arr[pos] = key;
+   size++;
+}
+
+inline int SortedArray::find(int key) const{
+   int pos = upperBound(arr, size, key) - 1;
+   return (pos >= 0 && arr[pos] == key) ? pos : -1;
+}
+
+// A sorted set of ints stored with gaps (Packed Memory Array)
+class GappedSortedArray{
+   std::vector<int> slots; // capacity slots, segment s is slots[s*seg .. s*seg+seg-1]
+   std::vector<int> cnt; // number of elements packed at the start of each segment
+   int seg; // slots per segment
+   int size; // current number of elements
+   int segmentFor(int key) const;
+   void spread(int first, int segs, const std::vector<int>& items);
+   void grow(int key);
+public:
+    GappedSortedArray();
+    // Inserts a new key, keeping the elements sorted
+    void insert(int key);
+    bool contains(int key) const;
+    int getSize() const { return size; }
+    // Copies the elements, in sorted order, to out[] (room for getSize() entries)
+    void toArray(int out[]) const;
+};
+
+inline GappedSortedArray::GappedSortedArray(){
+   seg = 8;
+   size = 0;
+   slots.assign(seg, 0);
+   cnt.assign(1, 0);
+}
+
+// Last segment whose first element is <= key (segment 0 if there is none).
+// Rebalancing leaves every segment non-empty once size > 0, so first elements are sorted.
+inline int GappedSortedArray::segmentFor(int key) const{
+   int l = 0, r = (int)cnt.size() - 1;
+   while (l < r){
+      int m = l + (r - l + 1) / 2;
+      if (cnt[m] > 0 && slots[m * seg] <= key)
+         l = m;
+      else
+         r = m - 1;
+   }
+   return l;
+}
+
+// Writes the sorted items evenly over segments first..first+segs-1, packed at the start of each
+inline void GappedSortedArray::spread(int first, int segs, const std::vector<int>& items){
+   int m = (int)items.size(), k = 0;
+   for (int s = 0; s < segs; s++){
+      int take = (int)((long long)m * (s + 1) / segs - (long long)m * s / segs);
+      memcpy(&slots[(first + s) * seg], items.data() + k, take * sizeof(int));
+      cnt[first + s] = take;
+      k += take;
+   }
+}
+
+// Doubles the capacity and spreads all elements plus key over it
+inline void GappedSortedArray::grow(int key){
+   std::vector<int> items(size);
+   toArray(items.data());
+   items.insert(std::upper_bound(items.begin(), items.end(), key), key);
+   int capacity = (int)slots.size() * 2;
+   // Keep segments about log2(capacity) slots long, rounded up to a power of two
+   int lg = 0;
+   while ((1 << lg) < capacity)
+      lg++;
+   seg = 8;
+   while (seg < lg)
+      seg *= 2;
+   slots.assign(capacity, 0);
+   cnt.assign(capacity / seg, 0);
+   spread(0, capacity / seg, items);
+   size++;
+}
+
+inline void GappedSortedArray::insert(int key){
+   int s = segmentFor(key);
+   int *base = &slots[s * seg];
+   if (cnt[s] < seg){
+      // Room in the segment: binary search + memmove of at most seg elements
+      int l = upperBound(base, cnt[s], key);
+      memmove(&base[l + 1], &base[l], (cnt[s] - l) * sizeof(int));
+      base[l] = key;
+      cnt[s]++;
+      size++;
+      return;
+   }
+   // Segment full: find the smallest enclosing window that can take one more element
+   int segments = (int)cnt.size();
+   int height = 0;
+   while ((1 << height) < segments)
+      height++;
+   for (int h = 1, width = 2; width <= segments; h++, width *= 2){
+      int first = s / width * width;
+      long long count = 1;
+      for (int i = first; i < first + width; i++)
+         count += cnt[i];
+      // Upper density bound: 1 at the leaves, 3/4 for the whole array
+      if (count * 4 * height <= (long long)width * seg * (4 * height - h)){
+         std::vector<int> items;
+         items.reserve(count);
+         for (int i = first; i < first + width; i++)
+            items.insert(items.end(), &slots[i * seg], &slots[i * seg] + cnt[i]);
+         items.insert(std::upper_bound(items.begin(), items.end(), key), key);
+         spread(first, width, items);
+         size++;
+         return;
+      }
+   }
+   grow(key);
+}
+
+inline bool GappedSortedArray::contains(int key) const{
+   int s = segmentFor(key);
+   const int *base = &slots[s * seg];
+   int pos = upperBound(base, cnt[s], key) - 1;
+   return pos >= 0 && base[pos] == key;
+}
+
+inline void GappedSortedArray::toArray(int out[]) const{
+   int k = 0;
+   for (int s = 0; s < (int)cnt.size(); s++)
+      for (int i = 0; i < cnt[s]; i++)
+         out[k++] = slots[s * seg + i];
+}
+
+enum GapSequence { CIURA, TOKUDA };
+
+// Fills gaps[] in increasing order with every gap smaller than n, returns how many
+inline int makeGaps(GapSequence seq, int n, int gaps[]){
+   static const int ciura[] = { 1, 4, 10, 23, 57, 132, 301, 701 };
+   int k = 0;
+   if (seq == CIURA){
+      for (int i = 0; i < 8 && ciura[i] < n; i++)
+         gaps[k++] = ciura[i];
+      // Beyond the measured gaps, extend by 2.25
+      if (k == 8)
+         while ((long long)gaps[k - 1] * 9 / 4 < n){
+            gaps[k] = (int)((long long)gaps[k - 1] * 9 / 4);
+            k++;
+         }
+   } else {
+      for (int i = 0; ; i++){
+         double h = std::ceil((9.0 * std::pow(2.25, i) - 4.0) / 5.0);
+         if (h >= n)
+            break;
+         gaps[k++] = (int)h;
+      }
+   }
+   if (k == 0)
+      gaps[k++] = 1;
+   return k;
+}
+
+// The insertion sort kernel on the chains arr[i], arr[i+gap], arr[i+2*gap], ...
+inline void gapInsertionSort(int arr[], int n, int gap){
+   for (int i = gap; i < n; i++){
+      int key = arr[i];
+      int j = i - gap;
+      while (j >= 0 && arr[j] > key){
+         arr[j + gap] = arr[j];
+         j -= gap;
+      }
+      arr[j + gap] = key;
+   }
+}
+
+// Function to sort an array using Shell sort
+inline void shellSort(int arr[], int n, GapSequence seq = CIURA){
+   int gaps[64];
+   int k = makeGaps(seq, n, gaps);
+   while (k-- > 0)
+      gapInsertionSort(arr, n, gaps[k]);
+}
+
+} // namespace sorting
+
+#endif
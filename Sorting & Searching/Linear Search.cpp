@@ -22,15 +22,9 @@ Element x is not present in arr[].
 
 // if x is present then return its location, otherwise return -1
 #include <iostream>
+#include "LinearSearch.h"
 using namespace std;
-
-int search(int arr[], int n, int x){
-   int i;
-   for (i = 0; i < n; i++)
-      if (arr[i] == x)
-         return i;
-   return -1;
-}
+using namespace sorting;
 
 int main(void){
    int arr[] = { 2, 3, 4, 10, 40 };
@@ -41,3 +35,106 @@ int main(void){
                  : cout<<"Element is present at index " <<result;
    return 0;
 }
+
+
+/* Vectorized Linear Search
+For small unsorted tables (up to a few thousand entries) a linear scan is often faster than hashing,
+but only if it compares many keys per instruction instead of one.
+
+Algorithm:
+1. Broadcast x into every lane of a vector register.
+2. Load several vectors of arr[] per iteration (SSE2: 16 ints = one cache line, AVX2: 32 ints = two cache lines)
+   and compare them against the key. Each lane becomes all ones (match) or all zeros.
+3. OR the comparison results together and test them once, so the loop has a single branch per iteration.
+4. On a hit, turn each comparison into a bit mask (movemask) and count trailing zeros to get the first index.
+5. Finish the last n % width elements with the scalar loop.
+
+The fastest path is chosen once at runtime from the CPU features (AVX2, else SSE2, else scalar),
+so the same binary runs on every x86-64 machine and on other architectures.
+
+Two variants for analytics filters use the same kernel:
+countMatches() - number of elements equal to x (adds the all-ones masks, i.e. subtracts -1, per lane)
+findAll()      - writes every index where arr[i] == x into out[] (walks the set bits of each mask)
+
+Time Complexity:
+Best: Ω(1)
+Average: θ(n)
+Worst: O(n), with n/8 vector compares instead of n scalar ones
+*/
+
+#include <iostream>
+#include "LinearSearch.h"
+using namespace std;
+using namespace sorting;
+
+int main(void){
+   int arr[40];
+   int n = sizeof(arr) / sizeof(arr[0]);
+   for (int i = 0; i < n; i++)
+      arr[i] = i % 10;
+   int x = 7;
+   int result = search(arr, n, x);
+   (result == -1)? cout<<"Element is not present in array"
+                 : cout<<"Element is present at index " <<result;
+   cout << "\nElement occurs " << countMatches(arr, n, x) << " times at indexes:";
+   int out[40];
+   int found = findAll(arr, n, x, out);
+   for (int i = 0; i < found; i++)
+      cout << " " << out[i];
+   cout << endl;
+   return 0;
+}
+
+
+/* Parallel Linear Search
+For very large in-memory arrays (10^9 elements) one core cannot read memory fast enough;
+the scan has to be split across threads so that all memory channels are busy.
+
+Algorithm (first match):
+1. Cut arr[] into fixed-size blocks and let the worker threads take them in increasing order from a shared counter.
+2. Every worker scans its block; on a hit it lowers the shared best index with an atomic compare-and-swap.
+3. Before taking a block a worker checks the best index found so far.
+   A block that starts after it cannot contain an earlier match, so the worker stops (cooperative cancellation).
+4. The result is the lowest index found, which is the same answer as the sequential search().
+
+Algorithm (all matches):
+1. Give each thread one contiguous slice of arr[], so the data it reads is its own
+   (on a multi-socket machine, fill the array with the same slices to keep each slice on the socket that scans it).
+2. Each thread writes its hits into its own buffer, so no locking is needed while scanning.
+3. Concatenate the buffers in thread order; the result is already sorted by index.
+
+Inside a block, 64 elements are compared at a time without branching (the compiler vectorizes that loop),
+and only a sub-block that contains the key is scanned again to find the exact index.
+
+Time Complexity:
+Best: Ω(1)
+Average: θ(n / p) for p threads, until memory bandwidth is the limit
+Worst: O(n / p)
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include "LinearSearch.h"
+using namespace std;
+using namespace sorting;
+
+// Driver code
+int main(void){
+   long long n = 50000000;
+   vector<int> arr(n);
+   for (long long i = 0; i < n; i++)
+      arr[i] = (int)(i % 1000003);
+   int x = 999999;
+   int threads = defaultThreads();
+
+   auto start = chrono::steady_clock::now();
+   long long result = parallelSearch(arr.data(), n, x, threads);
+   vector<long long> all = parallelFindAll(arr.data(), n, x, threads);
+   double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+   (result == -1)? cout<<"Element is not present in array"
+                 : cout<<"Element is present at index " <<result;
+   cout << "\nElement occurs " << all.size() << " times (" << threads << " threads, " << ms << " ms)" << endl;
+   return 0;
+}
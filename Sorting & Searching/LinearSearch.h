@@ -0,0 +1,289 @@
+/* Linear Search (Linear Search.cpp describes each version):
+search(), countMatches(), findAll()       - vectorized scans (SSE2 / AVX2, chosen at runtime), scalar elsewhere
+parallelSearch(), parallelFindAll()       - the scan split between threads, first match or all matches
+*/
+
+#ifndef LINEAR_SEARCH_H
+#define LINEAR_SEARCH_H
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+namespace sorting {
+
+// Scalar fallback, identical to the simple search()
+inline int searchScalar(int arr[], int n, int x){
+   for (int i = 0; i < n; i++)
+      if (arr[i] == x)
+         return i;
+   return -1;
+}
+
+inline int countMatchesScalar(int arr[], int n, int x){
+   int count = 0;
+   for (int i = 0; i < n; i++)
+      count += (arr[i] == x);
+   return count;
+}
+
+inline int findAllScalar(int arr[], int n, int x, int out[]){
+   int k = 0;
+   for (int i = 0; i < n; i++)
+      if (arr[i] == x)
+         out[k++] = i;
+   return k;
+}
+
+#ifdef HAVE_X86_SIMD
+// SSE2: 4 ints per vector, 16 ints (one cache line) per iteration
+inline int searchSSE2(int arr[], int n, int x){
+   __m128i key = _mm_set1_epi32(x);
+   int i = 0;
+   for (; i + 16 <= n; i += 16){
+      __m128i c0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i)), key);
+      __m128i c1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 4)), key);
+      __m128i c2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 8)), key);
+      __m128i c3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 12)), key);
+      __m128i any = _mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3));
+      if (_mm_movemask_epi8(any) != 0){
+         unsigned mask = _mm_movemask_ps(_mm_castsi128_ps(c0))
+                       | _mm_movemask_ps(_mm_castsi128_ps(c1)) << 4
+                       | _mm_movemask_ps(_mm_castsi128_ps(c2)) << 8
+                       | _mm_movemask_ps(_mm_castsi128_ps(c3)) << 12;
+         return i + __builtin_ctz(mask);
+      }
+   }
+   int r = searchScalar(arr + i, n - i, x);
+   return (r == -1) ? -1 : i + r;
+}
+
+// AVX2: 8 ints per vector, 32 ints (two cache lines) per iteration
+__attribute__((target("avx2")))
+inline int searchAVX2(int arr[], int n, int x){
+   __m256i key = _mm256_set1_epi32(x);
+   int i = 0;
+   for (; i + 32 <= n; i += 32){
+      __m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), key);
+      __m256i c1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 8)), key);
+      __m256i c2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 16)), key);
+      __m256i c3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 24)), key);
+      __m256i any = _mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, c3));
+      if (!_mm256_testz_si256(any, any)){
+         unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(c0))
+                       | (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(c1)) << 8
+                       | (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(c2)) << 16
+                       | (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(c3)) << 24;
+         return i + __builtin_ctz(mask);
+      }
+   }
+   for (; i + 8 <= n; i += 8){
+      __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), key);
+      int mask = _mm256_movemask_ps(_mm256_castsi256_ps(c));
+      if (mask != 0)
+         return i + __builtin_ctz(mask);
+   }
+   int r = searchScalar(arr + i, n - i, x);
+   return (r == -1) ? -1 : i + r;
+}
+
+// Four independent accumulators so the adds do not wait on each other
+__attribute__((target("avx2")))
+inline int countMatchesAVX2(int arr[], int n, int x){
+   __m256i key = _mm256_set1_epi32(x);
+   __m256i acc0 = _mm256_setzero_si256(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+   int i = 0;
+   for (; i + 32 <= n; i += 32){
+      // A match is -1 in its lane, so subtracting it adds one
+      acc0 = _mm256_sub_epi32(acc0, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), key));
+      acc1 = _mm256_sub_epi32(acc1, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 8)), key));
+      acc2 = _mm256_sub_epi32(acc2, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 16)), key));
+      acc3 = _mm256_sub_epi32(acc3, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 24)), key));
+   }
+   __m256i acc = _mm256_add_epi32(_mm256_add_epi32(acc0, acc1), _mm256_add_epi32(acc2, acc3));
+   int lanes[8];
+   _mm256_storeu_si256((__m256i*)lanes, acc);
+   int count = 0;
+   for (int l = 0; l < 8; l++)
+      count += lanes[l];
+   return count + countMatchesScalar(arr + i, n - i, x);
+}
+
+__attribute__((target("avx2")))
+inline int findAllAVX2(int arr[], int n, int x, int out[]){
+   __m256i key = _mm256_set1_epi32(x);
+   int i = 0, k = 0;
+   for (; i + 8 <= n; i += 8){
+      __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), key);
+      unsigned mask = _mm256_movemask_ps(_mm256_castsi256_ps(c));
+      // Emit one index per set bit, lowest first
+      while (mask != 0){
+         out[k++] = i + __builtin_ctz(mask);
+         mask &= mask - 1;
+      }
+   }
+   for (; i < n; i++)
+      if (arr[i] == x)
+         out[k++] = i;
+   return k;
+}
+#endif
+
+typedef int (*SearchFn)(int[], int, int);
+typedef int (*CountFn)(int[], int, int);
+typedef int (*FindAllFn)(int[], int, int, int[]);
+
+inline bool hasAVX2(){
+#ifdef HAVE_X86_SIMD
+   __builtin_cpu_init();
+   return __builtin_cpu_supports("avx2");
+#else
+   return false;
+#endif
+}
+
+inline SearchFn pickSearch(){
+#ifdef HAVE_X86_SIMD
+   return hasAVX2() ? searchAVX2 : searchSSE2;
+#else
+   return searchScalar;
+#endif
+}
+
+// if x is present then return its first location, otherwise return -1
+inline int search(int arr[], int n, int x){
+   // Resolved once, on the first call
+   static const SearchFn fn = pickSearch();
+   return fn(arr, n, x);
+}
+
+// Returns how many elements of arr[] are equal to x
+inline int countMatches(int arr[], int n, int x){
+#ifdef HAVE_X86_SIMD
+   static const CountFn fn = hasAVX2() ? countMatchesAVX2 : countMatchesScalar;
+#else
+   static const CountFn fn = countMatchesScalar;
+#endif
+   return fn(arr, n, x);
+}
+
+// Writes the indexes of all elements equal to x into out[] (room for n entries) and returns how many
+inline int findAll(int arr[], int n, int x, int out[]){
+#ifdef HAVE_X86_SIMD
+   static const FindAllFn fn = hasAVX2() ? findAllAVX2 : findAllScalar;
+#else
+   static const FindAllFn fn = findAllScalar;
+#endif
+   return fn(arr, n, x, out);
+}
+
+const long long BLOCK = 1 << 16; // elements taken by a worker at a time
+const int STRIP = 64;            // elements compared without a branch
+
+// Returns the first index of x in arr[lo..hi), or -1
+inline long long scanFirst(const int arr[], long long lo, long long hi, int x){
+   long long i = lo;
+   for (; i + STRIP <= hi; i += STRIP){
+      int hit = 0;
+      for (int j = 0; j < STRIP; j++)
+         hit |= (arr[i + j] == x);
+      if (hit)
+         for (int j = 0; j < STRIP; j++)
+            if (arr[i + j] == x)
+               return i + j;
+   }
+   for (; i < hi; i++)
+      if (arr[i] == x)
+         return i;
+   return -1;
+}
+
+// Appends every index of x in arr[lo..hi) to out
+inline void scanAll(const int arr[], long long lo, long long hi, int x, std::vector<long long>& out){
+   long long i = lo;
+   for (; i + STRIP <= hi; i += STRIP){
+      int hit = 0;
+      for (int j = 0; j < STRIP; j++)
+         hit |= (arr[i + j] == x);
+      if (hit)
+         for (int j = 0; j < STRIP; j++)
+            if (arr[i + j] == x)
+               out.push_back(i + j);
+   }
+   for (; i < hi; i++)
+      if (arr[i] == x)
+         out.push_back(i);
+}
+
+inline int defaultThreads(){
+   int t = (int)std::thread::hardware_concurrency();
+   return t > 0 ? t : 1;
+}
+
+// if x is present then return its first location, otherwise return -1
+inline long long parallelSearch(const int arr[], long long n, int x, int threads){
+   if (threads <= 0)
+      threads = defaultThreads();
+   std::atomic<long long> next(0);  // start of the next block to scan
+   std::atomic<long long> best(n);  // lowest index found so far (n means none)
+   auto worker = [&](){
+      for (;;){
+         long long lo = next.fetch_add(BLOCK, std::memory_order_relaxed);
+         // Nothing left, or every remaining block lies after a match already found
+         if (lo >= n || lo >= best.load(std::memory_order_relaxed))
+            return;
+         long long hi = std::min(lo + BLOCK, n);
+         long long r = scanFirst(arr, lo, hi, x);
+         if (r != -1){
+            long long cur = best.load(std::memory_order_relaxed);
+            while (r < cur && !best.compare_exchange_weak(cur, r, std::memory_order_relaxed))
+               ;
+            return;
+         }
+      }
+   };
+   std::vector<std::thread> pool;
+   for (int t = 1; t < threads; t++)
+      pool.emplace_back(worker);
+   worker(); // the calling thread works too
+   for (auto& th : pool)
+      th.join();
+   long long r = best.load();
+   return (r == n) ? -1 : r;
+}
+
+// Returns every index of x in arr[], in increasing order
+inline std::vector<long long> parallelFindAll(const int arr[], long long n, int x, int threads){
+   if (threads <= 0)
+      threads = defaultThreads();
+   std::vector<std::vector<long long>> partial(threads);
+   auto worker = [&](int t){
+      long long lo = n * t / threads;
+      long long hi = n * (t + 1) / threads;
+      scanAll(arr, lo, hi, x, partial[t]);
+   };
+   std::vector<std::thread> pool;
+   for (int t = 1; t < threads; t++)
+      pool.emplace_back(worker, t);
+   worker(0);
+   for (auto& th : pool)
+      th.join();
+   // Merge the per-thread buffers; slices are in order so the result is sorted
+   size_t total = 0;
+   for (auto& p : partial)
+      total += p.size();
+   std::vector<long long> out;
+   out.reserve(total);
+   for (auto& p : partial)
+      out.insert(out.end(), p.begin(), p.end());
+   return out;
+}
+
+} // namespace sorting
+
+#endif
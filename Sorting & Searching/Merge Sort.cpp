@@ -16,6 +16,11 @@ If r > l
  4. Merge the two halves sorted in step 2 and 3:
       Call merge(arr, l, m, r)
 
+The code is in MergeSort.h (namespace sorting), shared with sort() and parallelMergeSort(), with a few changes:
+merge() goes through one scratch buffer as long as the array instead of temporary arrays L[] and R[] on the stack,
+subarrays of up to SMALL elements are sorted with insertion sort, and the merge is skipped when the two halves
+are already in order (arr[m] <= arr[m+1]). mergeSort(arr, n) allocates the buffer.
+
 Time Complexity:
 Best: Ω(n log(n))
 Average: θ(n log(n))
@@ -23,61 +28,9 @@ Worst: O(n log(n))
 */
 
 #include <iostream>
-
-// Merges two subarrays of arr[].
-// First subarray is arr[l..m]
-// Second subarray is arr[m+1..r]
-void merge(int arr[], int l, int m, int r){
-   int i, j, k;
-   int n1 = m - l + 1;
-   int n2 = r - m;
-   /* create temp arrays */
-   int L[n1], R[n2];
-   /* Copy data to temp arrays L[] and R[] */
-   for (i = 0; i < n1; i++)
-      L[i] = arr[l + i];
-   for (j = 0; j < n2; j++)
-      R[j] = arr[m + 1 + j];
-   /* Merge the temp arrays back into arr[l..r]*/
-   i = 0; // Initial index of first subarray
-   j = 0; // Initial index of second subarray
-   k = l; // Initial index of merged subarray
-   while (i < n1 && j < n2) {
-      if (L[i] <= R[j]) {
-         arr[k] = L[i];
-         i++;
-      } else {
-            arr[k] = R[j];
-            j++;
-        }
-       k++;
-    }
-    // Copy the remaining elements of L[], if there are any
-    while (i < n1) {
-       arr[k] = L[i];
-       i++;
-       k++;
-    }
-    // Copy the remaining elements of R[], if there are any
-    while (j < n2) {
-       arr[k] = R[j];
-       j++;
-       k++;
-    }
-}
-
-// l is for left index and r is right index of the sub-array of arr to be sorted
-void mergeSort(int arr[], int l, int r){
-   if (l < r) {
-      // Same as (l+r)/2, but avoids overflow for
-      // large l and h
-      int m = l + (r - l) / 2;
-      // Sort first and second halves
-      mergeSort(arr, l, m);
-      mergeSort(arr, m + 1, r);
-      merge(arr, l, m, r);
-    }
-}
+#include <cstdio>
+#include "MergeSort.h"
+using namespace sorting;
 
 // Function to print an array
 void printArray(int A[], int size){
@@ -94,7 +47,7 @@ int main(){
    printf("Given array is \n");
    printArray(arr, arr_size);
 
-   mergeSort(arr, 0, arr_size - 1);
+   mergeSort(arr, arr_size);
    printf("\nSorted array is \n");
    printArray(arr, arr_size);
    return 0;
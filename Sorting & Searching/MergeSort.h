@@ -0,0 +1,70 @@
+/* Merge Sort, as used by sort() (Merge Sort.cpp describes the algorithm), with two changes:
+one scratch buffer tmp (as long as arr) for all merges instead of arrays on the stack,
+and runs of up to SMALL elements sorted with insertion sort. The merge of two halves already in order is skipped,
+so sorted runs cost O(n).
+*/
+
+#ifndef MERGE_SORT_H
+#define MERGE_SORT_H
+
+#include <vector>
+#include "InsertionSort.h"
+
+namespace sorting {
+
+// Merges arr[l..m] and arr[m+1..r] through tmp
+template <class C>
+inline void merge(int arr[], int tmp[], long l, long m, long r, C& c){
+   long i = l, j = m + 1, k = l;
+   while (i <= m && j <= r)
+      tmp[k++] = !c.less(arr[j], arr[i]) ? arr[i++] : arr[j++];
+   while (i <= m)
+      tmp[k++] = arr[i++];
+   // What is left of the right half is already in place
+   for (long x = l; x < k; x++){
+      arr[x] = tmp[x];
+      c.moved();
+   }
+}
+
+// l is for left index and r is right index of the sub-array of arr to be sorted
+template <class C>
+inline void mergeSort(int arr[], int tmp[], long l, long r, C& c){
+   if (r - l + 1 <= SMALL){
+      insertionSort(arr + l, (int)(r - l + 1), c);
+      return;
+   }
+   long m = l + (r - l) / 2;
+   mergeSort(arr, tmp, l, m, c);
+   mergeSort(arr, tmp, m + 1, r, c);
+   if (c.less(arr[m + 1], arr[m])) // halves already in order: nothing to merge
+      merge(arr, tmp, l, m, r, c);
+}
+
+// Sorts arr[0..n-1] with a buffer of its own
+template <class C>
+inline void mergeSort(int arr[], int n, C& c){
+   if (n < 2)
+      return;
+   std::vector<int> tmp(n);
+   mergeSort(arr, tmp.data(), 0, n - 1, c);
+}
+
+inline void merge(int arr[], int tmp[], long l, long m, long r){
+   NoCount c;
+   merge(arr, tmp, l, m, r, c);
+}
+
+inline void mergeSort(int arr[], int tmp[], long l, long r){
+   NoCount c;
+   mergeSort(arr, tmp, l, r, c);
+}
+
+inline void mergeSort(int arr[], int n){
+   NoCount c;
+   mergeSort(arr, n, c);
+}
+
+} // namespace sorting
+
+#endif
@@ -0,0 +1,192 @@
+/* Minimum and maximum with the first index of each, vectorized (AVX-512 / AVX2, chosen at runtime).
+The one kernel of this repository for the scan: Selection Sort (SelectionSort.h) finds the minimum and maximum
+of the unsorted part with it, and Divide-et-Impera.cpp describes it and reduces with it (DivideEtImpera.h).
+*/
+
+#ifndef MIN_MAX_H
+#define MIN_MAX_H
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+namespace sorting {
+
+// Minimum and maximum of an array and the first index of each
+struct MinMaxIndex{
+   int min;
+   int max;
+   long long minIndex;
+   long long maxIndex;
+};
+
+// Combines two results; on equal values the smaller index wins
+inline struct MinMaxIndex combine(struct MinMaxIndex b, struct MinMaxIndex c){
+   struct MinMaxIndex d = b;
+   if (c.min < d.min || (c.min == d.min && c.minIndex < d.minIndex)){
+      d.min = c.min;
+      d.minIndex = c.minIndex;
+   }
+   if (c.max > d.max || (c.max == d.max && c.maxIndex < d.maxIndex)){
+      d.max = c.max;
+      d.maxIndex = c.maxIndex;
+   }
+   return d;
+}
+
+// Scalar kernel over a[0..n-1], n >= 1
+inline struct MinMaxIndex minMaxIndexScalar(const int a[], int n){
+   struct MinMaxIndex r = { a[0], a[0], 0, 0 };
+   for (int i = 1; i < n; i++){
+      if (a[i] < r.min){
+         r.min = a[i];
+         r.minIndex = i;
+      }
+      if (a[i] > r.max){
+         r.max = a[i];
+         r.maxIndex = i;
+      }
+   }
+   return r;
+}
+
+// Reduces the lanes of value/index vectors stored to memory
+inline struct MinMaxIndex reduceLanes(const int mins[], const int minIdx[], const int maxs[], const int maxIdx[], int lanes){
+   struct MinMaxIndex r = { mins[0], maxs[0], minIdx[0], maxIdx[0] };
+   for (int l = 1; l < lanes; l++){
+      struct MinMaxIndex c = { mins[l], maxs[l], minIdx[l], maxIdx[l] };
+      r = combine(r, c);
+   }
+   return r;
+}
+
+#ifdef HAVE_X86_SIMD
+// AVX2 kernel, n >= 16
+__attribute__((target("avx2")))
+inline struct MinMaxIndex minMaxIndexAVX2(const int a[], int n){
+   __m256i step = _mm256_set1_epi32(8);
+   __m256i idx0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+   __m256i idx1 = _mm256_add_epi32(idx0, step);
+   step = _mm256_set1_epi32(16);
+   __m256i min0 = _mm256_loadu_si256((const __m256i*)a), max0 = min0, minI0 = idx0, maxI0 = idx0;
+   __m256i min1 = _mm256_loadu_si256((const __m256i*)(a + 8)), max1 = min1, minI1 = idx1, maxI1 = idx1;
+   int i = 16;
+   for (; i + 16 <= n; i += 16){
+      idx0 = _mm256_add_epi32(idx0, step);
+      idx1 = _mm256_add_epi32(idx1, step);
+      __m256i x0 = _mm256_loadu_si256((const __m256i*)(a + i));
+      __m256i x1 = _mm256_loadu_si256((const __m256i*)(a + i + 8));
+      __m256i lt0 = _mm256_cmpgt_epi32(min0, x0), gt0 = _mm256_cmpgt_epi32(x0, max0);
+      __m256i lt1 = _mm256_cmpgt_epi32(min1, x1), gt1 = _mm256_cmpgt_epi32(x1, max1);
+      min0 = _mm256_min_epi32(min0, x0);
+      max0 = _mm256_max_epi32(max0, x0);
+      min1 = _mm256_min_epi32(min1, x1);
+      max1 = _mm256_max_epi32(max1, x1);
+      minI0 = _mm256_blendv_epi8(minI0, idx0, lt0);
+      maxI0 = _mm256_blendv_epi8(maxI0, idx0, gt0);
+      minI1 = _mm256_blendv_epi8(minI1, idx1, lt1);
+      maxI1 = _mm256_blendv_epi8(maxI1, idx1, gt1);
+   }
+   int mins[16], minIdx[16], maxs[16], maxIdx[16];
+   _mm256_storeu_si256((__m256i*)mins, min0);
+   _mm256_storeu_si256((__m256i*)(mins + 8), min1);
+   _mm256_storeu_si256((__m256i*)minIdx, minI0);
+   _mm256_storeu_si256((__m256i*)(minIdx + 8), minI1);
+   _mm256_storeu_si256((__m256i*)maxs, max0);
+   _mm256_storeu_si256((__m256i*)(maxs + 8), max1);
+   _mm256_storeu_si256((__m256i*)maxIdx, maxI0);
+   _mm256_storeu_si256((__m256i*)(maxIdx + 8), maxI1);
+   struct MinMaxIndex r = reduceLanes(mins, minIdx, maxs, maxIdx, 16);
+   if (i < n){
+      struct MinMaxIndex tail = minMaxIndexScalar(a + i, n - i);
+      tail.minIndex += i;
+      tail.maxIndex += i;
+      r = combine(r, tail);
+   }
+   return r;
+}
+
+// AVX-512 kernel, n >= 32
+__attribute__((target("avx512f")))
+inline struct MinMaxIndex minMaxIndexAVX512(const int a[], int n){
+   __m512i idx0 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+   __m512i idx1 = _mm512_add_epi32(idx0, _mm512_set1_epi32(16));
+   __m512i step = _mm512_set1_epi32(32);
+   __m512i min0 = _mm512_loadu_si512(a), max0 = min0, minI0 = idx0, maxI0 = idx0;
+   __m512i min1 = _mm512_loadu_si512(a + 16), max1 = min1, minI1 = idx1, maxI1 = idx1;
+   int i = 32;
+   for (; i + 32 <= n; i += 32){
+      idx0 = _mm512_add_epi32(idx0, step);
+      idx1 = _mm512_add_epi32(idx1, step);
+      __m512i x0 = _mm512_loadu_si512(a + i);
+      __m512i x1 = _mm512_loadu_si512(a + i + 16);
+      __mmask16 lt0 = _mm512_cmplt_epi32_mask(x0, min0), gt0 = _mm512_cmpgt_epi32_mask(x0, max0);
+      __mmask16 lt1 = _mm512_cmplt_epi32_mask(x1, min1), gt1 = _mm512_cmpgt_epi32_mask(x1, max1);
+      min0 = _mm512_mask_mov_epi32(min0, lt0, x0);
+      max0 = _mm512_mask_mov_epi32(max0, gt0, x0);
+      min1 = _mm512_mask_mov_epi32(min1, lt1, x1);
+      max1 = _mm512_mask_mov_epi32(max1, gt1, x1);
+      minI0 = _mm512_mask_blend_epi32(lt0, minI0, idx0);
+      maxI0 = _mm512_mask_blend_epi32(gt0, maxI0, idx0);
+      minI1 = _mm512_mask_blend_epi32(lt1, minI1, idx1);
+      maxI1 = _mm512_mask_blend_epi32(gt1, maxI1, idx1);
+   }
+   int mins[32], minIdx[32], maxs[32], maxIdx[32];
+   _mm512_storeu_si512(mins, min0);
+   _mm512_storeu_si512(mins + 16, min1);
+   _mm512_storeu_si512(minIdx, minI0);
+   _mm512_storeu_si512(minIdx + 16, minI1);
+   _mm512_storeu_si512(maxs, max0);
+   _mm512_storeu_si512(maxs + 16, max1);
+   _mm512_storeu_si512(maxIdx, maxI0);
+   _mm512_storeu_si512(maxIdx + 16, maxI1);
+   struct MinMaxIndex r = reduceLanes(mins, minIdx, maxs, maxIdx, 32);
+   if (i < n){
+      struct MinMaxIndex tail = minMaxIndexScalar(a + i, n - i);
+      tail.minIndex += i;
+      tail.maxIndex += i;
+      r = combine(r, tail);
+   }
+   return r;
+}
+#endif
+
+typedef struct MinMaxIndex (*MinMaxFn)(const int[], int);
+
+// Picks the widest kernel the CPU supports and the minimum length it needs
+inline MinMaxFn pickKernel(int *minLength){
+#ifdef HAVE_X86_SIMD
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx512f")){
+      *minLength = 32;
+      return minMaxIndexAVX512;
+   }
+   if (__builtin_cpu_supports("avx2")){
+      *minLength = 16;
+      return minMaxIndexAVX2;
+   }
+#endif
+   *minLength = 1;
+   return minMaxIndexScalar;
+}
+
+// Minimum and maximum of a[0..n-1] (n >= 1) with the first index of each
+inline struct MinMaxIndex minMaxIndex(const int a[], long long n){
+   static int minLength;
+   static MinMaxFn kernel = pickKernel(&minLength);
+   const long long CHUNK = 1LL << 30; // keeps lane indices within 32 bits
+   struct MinMaxIndex r;
+   for (long long start = 0; start < n; start += CHUNK){
+      int len = (int)((n - start < CHUNK) ? n - start : CHUNK);
+      struct MinMaxIndex c = (len >= minLength) ? kernel(a + start, len) : minMaxIndexScalar(a + start, len);
+      c.minIndex += start;
+      c.maxIndex += start;
+      r = (start == 0) ? c : combine(r, c);
+   }
+   return r;
+}
+
+} // namespace sorting
+
+#endif
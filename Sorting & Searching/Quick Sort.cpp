@@ -4,9 +4,9 @@ It picks an element as pivot and partitions the given array around the picked pi
 
 There are many different versions of quickSort that pick pivot in different ways:
 1. Always pick first element as pivot.
-2. Always pick last element as pivot (implemented below)
+2. Always pick last element as pivot (the partition below)
 3. Pick a random element as pivot.
-4. Pick median as pivot.
+4. Pick median as pivot (the code: median of the first, middle and last element).
 
 The key process is partition().
 Target of partitions is:
@@ -110,55 +110,22 @@ Now 70 is at its correct place. All elements smaller than
 70 are before it and all elements greater than 70 are after
 it.
 
+The code is in QuickSort.h (namespace sorting), shared with sort() and parallelQuickSort(). Picking the last
+element makes sorted and reversed arrays O(n^2), so partition() there first moves the median of arr[low],
+arr[mid] and arr[high] to arr[high] and then partitions as above. quickSort() also recurses only into
+the smaller part (O(log(n)) stack), leaves up to SMALL elements to insertion sort, and switches to heap sort
+below 2 log2(n) levels (Introsort), so the worst case is O(n log(n)) too.
+
 Time Complexity:
 Best: Ω(n log(n))
 Average: θ(n log(n))
-Worst: O(n^2)
+Worst: O(n^2) with the plain pseudo code, O(n log(n)) with the depth limit
 */
 
 #include <iostream>
+#include "QuickSort.h"
 using namespace std;
-
-// A utility function to swap two elements
-void swap(int* a, int* b){
-   int t = *a;
-   *a = *b;
-   *b = t;
-}
-
-/* This function takes last element as pivot, places
-the pivot element at its correct position in sorted
-array, and places all smaller (smaller than pivot)
-to left of pivot and all greater elements to right
-of pivot */
-int partition (int arr[], int low, int high){
-   int pivot = arr[high]; // pivot
-   int i = (low - 1); // Index of smaller element
-   for (int j = low; j <= high - 1; j++){
-      // If current element is smaller than the pivot
-      if (arr[j] < pivot){
-         i++; // increment index of smaller element
-         swap(&arr[i], &arr[j]);
-      }
-    }
-    swap(&arr[i + 1], &arr[high]);
-    return (i + 1);
-}
-
-// The main function that implements QuickSort
-// arr[] --> Array to be sorted,
-// low --> Starting index,
-// high --> Ending index
-void quickSort(int arr[], int low, int high){
-   if (low < high){
-      // pi is partitioning index, arr[p] is now at right place
-      int pi = partition(arr, low, high);
-      // Separately sort elements before
-      // partition and after partition
-      quickSort(arr, low, pi - 1);
-      quickSort(arr, pi + 1, high);
-    }
-}
+using namespace sorting;
 
 /* Function to print an array */
 void printArray(int arr[], int size){
@@ -172,7 +139,7 @@ void printArray(int arr[], int size){
 int main(){
    int arr[] = {10, 7, 8, 9, 1, 5};
    int n = sizeof(arr) / sizeof(arr[0]);
-   quickSort(arr, 0, n - 1);
+   quickSort(arr, n);
    cout << "Sorted array: \n";
    printArray(arr, n);
    return 0;
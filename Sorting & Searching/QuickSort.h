@@ -0,0 +1,83 @@
+/* Quick Sort, as used by sort() (Quick Sort.cpp describes the algorithm), made safe on any input:
+the pivot is the median of the first, middle and last element, only the smaller part is sorted recursively
+(O(log(n)) stack), ranges of up to SMALL elements are left to insertion sort, and below depth levels
+the rest is done by heap sort (Introsort), so it is never O(n^2).
+*/
+
+#ifndef QUICK_SORT_H
+#define QUICK_SORT_H
+
+#include <utility>
+#include "InsertionSort.h"
+#include "HeapSort.h"
+
+namespace sorting {
+
+// Lomuto partition around the median of arr[low], arr[mid] and arr[high] (moved to high)
+template <class C>
+inline int partition(int arr[], int low, int high, C& c){
+   int mid = low + (high - low) / 2;
+   if (c.less(arr[mid], arr[low]))
+      c.exchange(arr[mid], arr[low]);
+   if (c.less(arr[high], arr[low]))
+      c.exchange(arr[high], arr[low]);
+   if (c.less(arr[mid], arr[high]))
+      c.exchange(arr[mid], arr[high]);
+   int pivot = arr[high];
+   int i = low - 1;
+   for (int j = low; j <= high - 1; j++){
+      if (c.less(arr[j], pivot)){
+         i++;
+         c.exchange(arr[i], arr[j]);
+      }
+   }
+   c.exchange(arr[i + 1], arr[high]);
+   return i + 1;
+}
+
+// Quick sort of arr[low..high]; after depth levels the rest is done by heap sort
+template <class C>
+inline void quickSort(int arr[], int low, int high, int depth, C& c){
+   while (high - low + 1 > SMALL){
+      if (depth-- == 0){
+         heapSort(arr + low, high - low + 1, c);
+         return;
+      }
+      int pi = partition(arr, low, high, c);
+      // Recurse into the smaller part, loop on the larger: O(log(n)) stack
+      if (pi - low < high - pi){
+         quickSort(arr, low, pi - 1, depth, c);
+         low = pi + 1;
+      } else {
+         quickSort(arr, pi + 1, high, depth, c);
+         high = pi - 1;
+      }
+   }
+   insertionSort(arr + low, high - low + 1, c);
+}
+
+// Sorts arr[0..n-1] with the depth limit of Introsort, 2 log2(n)
+template <class C>
+inline void quickSort(int arr[], int n, C& c){
+   if (n > 1)
+      quickSort(arr, 0, n - 1, 2 * (31 - __builtin_clz(n)), c);
+}
+
+inline int partition(int arr[], int low, int high){
+   NoCount c;
+   return partition(arr, low, high, c);
+}
+
+inline void quickSort(int arr[], int low, int high, int depth){
+   NoCount c;
+   quickSort(arr, low, high, depth, c);
+}
+
+inline void quickSort(int arr[], int n){
+   NoCount c;
+   quickSort(arr, n, c);
+}
+
+} // namespace sorting
+
+#endif
@@ -21,6 +21,7 @@ Find the minimum element in arr[2...4] and place it at beginning of arr[2...4]
 
 Find the minimum element in arr[3...4] and place it at beginning of arr[3...4]
 11 12 22 25 64
+The code is selectionSort() in SelectionSort.h.
 
 Time Complexity:
 Best: Ω(n^2)
@@ -29,27 +30,9 @@ Worst: O(n^2)
 */
 
 #include <iostream>
+#include "SelectionSort.h"
 using namespace std;
-
-void swap(int *xp, int *yp){
-   int temp = *xp;
-   *xp = *yp;
-   *yp = temp;
-}
-
-void selectionSort(int arr[], int n){
-   int i, j, min_idx;
-   // One by one move boundary of unsorted subarray
-   for (i = 0; i < n-1; i++){
-      // Find the minimum element in unsorted array
-      min_idx = i;
-      for (j = i+1; j < n; j++)
-         if (arr[j] < arr[min_idx])
-            min_idx = j;
-         // Swap the found minimum element with the first element
-         swap(&arr[min_idx], &arr[i]);
-    }
-}
+using namespace sorting;
 
 // Function to print an array
 void printArray(int arr[], int size){
@@ -68,3 +51,87 @@ int main(){
    printArray(arr, n);
    return 0;
 }
+
+
+/* Selection Sort with Minimum and Maximum (double selection)
+selectionSort() above scans the unsorted part once per element, finds only the minimum,
+and swaps even when the minimum is already in place (min_idx == i), writing two elements for nothing.
+
+Algorithm:
+1. Keep the unsorted part arr[lo...hi]. In one scan find both its minimum and its maximum.
+2. Put the minimum at lo and the maximum at hi, then lo++ and hi--. Only n/2 scans are needed.
+   If the maximum was at lo, the first swap moved it to where the minimum was.
+3. A swap is skipped when the element is already in place (or equal to the one there),
+   so an array that is already sorted is not written at all.
+4. The scan is minMaxIndex() (MinMax.h, described in Divide-et-Impera.cpp): it compares 8 or 16 elements
+   at a time (AVX2 / AVX-512), keeping in each lane the smallest and largest value seen and its index;
+   the lanes are reduced at the end and the last few elements are scanned one by one.
+
+Selection sort does O(n) writes (bubble and insertion sort do O(n^2)),
+which is why it is used when writes are expensive (flash, NVRAM). selectionSort() always writes 2(n-1) elements,
+this version writes only the ones that move. The write-counting mode reports how many elements were written,
+so the two versions can be compared.
+
+Example:
+arr[] = 64 25 12 22 11
+Min 11, max 64 in arr[0...4]: 11 25 12 22 64
+Min 12, max 25 in arr[1...3]: 11 12 25 22 64 -> 11 12 22 25 64
+arr[2...2] has one element: sorted.
+
+Time Complexity:
+Best: Ω(n^2)
+Average: θ(n^2), n/2 scans of 8 or 16 elements per step
+Worst: O(n^2)
+*/
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "SelectionSort.h"
+using namespace std;
+using namespace sorting;
+
+// Function to print an array
+void printArray(int arr[], int size){
+   for (int i = 0; i < size; i++)
+      cout << arr[i] << " ";
+   cout << endl;
+}
+
+// Driver program to test above functions
+int main(){
+   int arr[] = {64, 25, 12, 22, 11};
+   int n = sizeof(arr)/sizeof(arr[0]);
+   long long writes = 0;
+   selectionSortMinMax(arr, n, &writes);
+   cout << "Sorted array: \n";
+   printArray(arr, n);
+   cout << "Elements written: " << writes << endl;
+
+   // Random and almost sorted data: time and writes of both versions
+   const int N = 20000;
+   mt19937 gen(1);
+   vector<int> random(N), almost(N);
+   for (int i = 0; i < N; i++){
+      random[i] = (int)(gen() % 1000000);
+      almost[i] = i;
+   }
+   for (int k = 0; k < 20; k++)
+      swap(almost[gen() % N], almost[gen() % N]);
+   for (vector<int>* data : { &random, &almost }){
+      vector<int> a = *data, b = *data;
+      long long w1 = 0, w2 = 0;
+      auto t0 = chrono::steady_clock::now();
+      selectionSort(a.data(), N, &w1);
+      auto t1 = chrono::steady_clock::now();
+      selectionSortMinMax(b.data(), N, &w2);
+      auto t2 = chrono::steady_clock::now();
+      cout << N << (data == &random ? " random" : " almost sorted") << " elements: selectionSort "
+           << chrono::duration<double, milli>(t1 - t0).count() << " ms, " << w1 << " writes; min/max "
+           << chrono::duration<double, milli>(t2 - t1).count() << " ms, " << w2 << " writes"
+           << (a == b ? "" : " (results differ!)") << endl;
+   }
+   return 0;
+}
@@ -0,0 +1,58 @@
+/* Selection Sort with write counting, and double selection sort (Selection Sort.cpp describes both):
+each scan finds the minimum and the maximum with minMaxIndex() of MinMax.h (vectorized) and only elements
+that move are written.
+*/
+
+#ifndef SELECTION_SORT_H
+#define SELECTION_SORT_H
+
+#include <utility>
+#include "MinMax.h"
+#include "Counter.h"
+
+namespace sorting {
+
+// Selection sort; if writes is not NULL, the number of elements written is added to it
+template <class C>
+inline void selectionSort(int arr[], int n, long long* writes, C& c){
+   for (int i = 0; i < n-1; i++){
+      int min_idx = i;
+      for (int j = i+1; j < n; j++)
+         if (c.less(arr[j], arr[min_idx]))
+            min_idx = j;
+      c.exchange(arr[min_idx], arr[i]);
+      if (writes != nullptr)
+         *writes += 2;
+   }
+}
+
+inline void selectionSort(int arr[], int n, long long* writes = nullptr){
+   NoCount c;
+   selectionSort(arr, n, writes, c);
+}
+
+// Swaps arr[i] and arr[j] unless that would not change the array; counts the elements written
+inline void swapIfNeeded(int arr[], int i, int j, long long* writes){
+   if (i == j || arr[i] == arr[j])
+      return;
+   std::swap(arr[i], arr[j]);
+   if (writes != nullptr)
+      *writes += 2;
+}
+
+// Double selection sort; if writes is not NULL, the number of elements written is added to it
+inline void selectionSortMinMax(int arr[], int n, long long* writes = nullptr){
+   for (int lo = 0, hi = n - 1; lo < hi; lo++, hi--){
+      MinMaxIndex r = minMaxIndex(arr + lo, hi - lo + 1);
+      int minIdx = lo + (int)r.minIndex, maxIdx = lo + (int)r.maxIndex;
+      swapIfNeeded(arr, lo, minIdx, writes);
+      // The maximum was at lo and has just been moved to minIdx
+      if (maxIdx == lo)
+         maxIdx = minIdx;
+      swapIfNeeded(arr, hi, maxIdx, writes);
+   }
+}
+
+} // namespace sorting
+
+#endif
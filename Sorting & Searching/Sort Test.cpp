@@ -0,0 +1,282 @@
+/* Sort (tests)
+Checks sort() with every forced algorithm, with and without extra memory, and every sorting engine of this folder
+against std::sort, on inputs of different kinds and sizes; the searches against std::find and std::count,
+parallelSearch() also over many BLOCKs, where a match in the first block cancels the other workers;
+mappedSearch() on a key file with and without the sparse index; MinHeap against std::sort;
+and the comparisons and swaps of the Count policy against the numbers known for sorted and reversed input.
+Prints each failure and returns 1 if there was any (run by ctest).
+*/
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include "Sort.h"
+#include "BubbleSort.h"
+#include "SelectionSort.h"
+#include "LinearSearch.h"
+#include "BinarySearch.h"
+#include "BinaryHeap.h"
+using namespace std;
+using namespace sorting;
+
+int failures = 0;
+
+void check(bool ok, const char* what, const char* kind, int n){
+   if (!ok){
+      failures++;
+      cout << "FAILED: " << what << " on " << kind << " input of " << n << " elements" << endl;
+   }
+}
+
+const char* kinds[] = { "random", "sorted", "reversed", "few unique", "almost sorted", "organ pipe",
+                        "wide range, duplicates", "INT_MIN and INT_MAX", "all equal", "sawtooth" };
+const int KINDS = 10;
+
+vector<int> makeInput(int kind, int n, mt19937& gen){
+   vector<int> data(n);
+   for (int i = 0; i < n; i++){
+      switch (kind){
+      case 0: data[i] = (int)gen(); break;
+      case 1: data[i] = i; break;
+      case 2: data[i] = n - i; break;
+      case 3: data[i] = (int)(gen() % 10); break;
+      case 4: data[i] = i + (int)(gen() % 100); break;
+      case 5: data[i] = (i < n / 2) ? i : n - i; break;
+      case 6: data[i] = (int)(gen() % 50) * 1000000; break;
+      case 7: { static const int extremes[] = { INT_MIN, INT_MAX, 0, -1, INT_MIN + 1, INT_MAX - 1 };
+                data[i] = extremes[gen() % 6]; break; }
+      case 8: data[i] = 7; break;
+      case 9: data[i] = i % 100; break;
+      }
+   }
+   return data;
+}
+
+struct Engine{
+   const char* name;
+   void (*run)(int arr[], int n);
+};
+
+const Engine engines[] = {
+   { "insertionSort", [](int a[], int n){ insertionSort(a, n); } },
+   { "insertionSortRecursive", [](int a[], int n){ insertionSortRecursive(a, n); } },
+   { "binaryInsertionSort", [](int a[], int n){ binaryInsertionSort(a, n); } },
+   { "shellSort (Ciura)", [](int a[], int n){ shellSort(a, n, CIURA); } },
+   { "shellSort (Tokuda)", [](int a[], int n){ shellSort(a, n, TOKUDA); } },
+   { "mergeSort", [](int a[], int n){ mergeSort(a, n); } },
+   { "quickSort", [](int a[], int n){ quickSort(a, n); } },
+   { "heapSort", [](int a[], int n){ heapSort(a, n); } },
+   { "bubbleSort", [](int a[], int n){ bubbleSort(a, n); } },
+   { "bubbleSortRecursive", [](int a[], int n){ bubbleSortRecursive(a, n); } },
+   { "cocktailSort", [](int a[], int n){ cocktailSort(a, n); } },
+   { "oddEvenSort (1 thread)", [](int a[], int n){ oddEvenSort(a, n, 1); } },
+   { "oddEvenSort (3 threads)", [](int a[], int n){ oddEvenSort(a, n, 3); } },
+   { "selectionSort", [](int a[], int n){ selectionSort(a, n); } },
+   { "selectionSortMinMax", [](int a[], int n){ selectionSortMinMax(a, n); } },
+   { "SortedArray", [](int a[], int n){
+        SortedArray s;
+        for (int i = 0; i < n; i++)
+           s.insert(a[i]);
+        for (int i = 0; i < n; i++)
+           a[i] = s.get(i);
+     } },
+   { "GappedSortedArray", [](int a[], int n){
+        GappedSortedArray s;
+        for (int i = 0; i < n; i++)
+           s.insert(a[i]);
+        s.toArray(a);
+     } },
+};
+
+// The searches on a sorted array of size n
+void checkSearches(const vector<int>& sorted, const char* kind){
+   int n = (int)sorted.size();
+   vector<int> arr = sorted, out(n);
+   int probes[] = { n > 0 ? sorted[0] : 0, n > 0 ? sorted[n / 2] : 1, n > 0 ? sorted[n - 1] : 2, 123456789, INT_MIN, INT_MAX };
+   for (int x : probes){
+      int first = (int)(find(sorted.begin(), sorted.end(), x) - sorted.begin());
+      int expected = (first == n) ? -1 : first;
+      int count = (int)std::count(sorted.begin(), sorted.end(), x);
+      check(search(arr.data(), n, x) == expected, "search", kind, n);
+      check(countMatches(arr.data(), n, x) == count, "countMatches", kind, n);
+      check(findAll(arr.data(), n, x, out.data()) == count && (count == 0 || out[0] == first), "findAll", kind, n);
+      check(parallelSearch(arr.data(), n, x, 3) == expected, "parallelSearch", kind, n);
+      check((long long)parallelFindAll(arr.data(), n, x, 3).size() == count, "parallelFindAll", kind, n);
+      long long found = (n > 0) ? binarySearch(arr.data(), 0, n - 1, x) : -1;
+      check(count == 0 ? found == -1 : (found >= 0 && sorted[found] == x), "binarySearch", kind, n);
+   }
+}
+
+// parallelSearch() and parallelFindAll() on several BLOCKs: a match in the first block, the last one, none
+void checkLargeSearches(mt19937& gen){
+   long long n = 5 * BLOCK + 123;
+   vector<int> arr(n);
+   for (long long i = 0; i < n; i++)
+      arr[i] = (int)(gen() % 1000000) + 10;
+   arr[3 * BLOCK + 5] = 1; // later copies of the first-block key: the workers that find them must not win
+   arr[4 * BLOCK] = 1;
+   arr[10] = 1;
+   arr[n - 1] = 2;
+   int probes[] = { 1, 2, 3 };
+   for (int x : probes){
+      long long first = find(arr.begin(), arr.end(), x) - arr.begin();
+      long long expected = (first == n) ? -1 : first;
+      for (int threads : { 1, 2, 4 }){
+         check(parallelSearch(arr.data(), n, x, threads) == expected, "parallelSearch over blocks", "large", (int)n);
+         vector<long long> all = parallelFindAll(arr.data(), n, x, threads);
+         check((long long)all.size() == count(arr.begin(), arr.end(), x) && is_sorted(all.begin(), all.end())
+               && (all.empty() || all[0] == first), "parallelFindAll over blocks", "large", (int)n);
+      }
+   }
+}
+
+// mappedSearch() on a file of sorted keys: whole-file search, the default index and a small stride
+void checkMappedSearch(mt19937& gen){
+   for (int n : { 0, 1, 1000, 50000 }){
+      vector<int> keys(n);
+      for (int& k : keys)
+         k = (int)(gen() % 100000) * 2; // even keys: every odd key is absent
+      std::sort(keys.begin(), keys.end());
+      char path[] = "/tmp/sort_test_XXXXXX";
+      int fd = mkstemp(path);
+      bool written = fd >= 0 && write(fd, keys.data(), n * sizeof(int)) == (ssize_t)(n * sizeof(int));
+      if (fd >= 0)
+         close(fd);
+      MappedKeys m;
+      check(written && openKeys(path, m) && m.n == n, "openKeys", "mapped", n);
+      for (long long stride : { -1LL, 0LL, 7LL }){
+         if (stride >= 0)
+            buildIndex(m, stride);
+         int probes[] = { n > 0 ? keys[0] : 0, n > 0 ? keys[n / 2] : 2, n > 0 ? keys[n - 1] : 4, 1, -2, 999999, INT_MAX };
+         for (int x : probes){
+            bool present = binary_search(keys.begin(), keys.end(), x);
+            long long r = mappedSearch(m, x);
+            check(present ? (r >= 0 && r < n && keys[r] == x) : r == -1, "mappedSearch", "mapped", n);
+         }
+      }
+      closeKeys(m);
+      unlink(path);
+   }
+}
+
+// insertKey() then extractMin() gives the keys in order; decreaseKey() and deleteKey() keep the heap valid
+void checkMinHeap(mt19937& gen){
+   for (int n : { 1, 2, 17, 1000 }){
+      vector<int> keys(n);
+      for (int& k : keys)
+         k = (int)(gen() % 1000);
+      vector<int> expected = keys;
+      std::sort(expected.begin(), expected.end());
+      MinHeap h(n);
+      for (int k : keys)
+         h.insertKey(k);
+      vector<int> out;
+      while (h.size() > 0)
+         out.push_back(h.extractMin());
+      check(out == expected && h.extractMin() == INT_MAX, "MinHeap", "random", n);
+      // The key at the last index becomes the minimum; the others come out in order after it
+      MinHeap c(n);
+      for (int k : keys)
+         c.insertKey(k);
+      c.decreaseKey(n - 1, -1);
+      out.clear();
+      while (c.size() > 0)
+         out.push_back(c.extractMin());
+      check(out[0] == -1 && is_sorted(out.begin(), out.end()) && includes(expected.begin(), expected.end(), out.begin() + 1, out.end()),
+            "MinHeap decreaseKey", "random", n);
+      MinHeap d(n);
+      for (int k : keys)
+         d.insertKey(k);
+      d.deleteKey(0);
+      check(d.size() == n - 1 && (n == 1 || d.getMin() == expected[1]), "MinHeap deleteKey", "random", n);
+   }
+}
+
+// Count on inputs whose comparisons and swaps are known exactly
+void checkCounts(){
+   for (int n : { 1, 2, 10, 1000 }){
+      long long pairs = (long long)n * (n - 1) / 2;
+      vector<int> sorted(n), reversed(n), equal(n, 7);
+      for (int i = 0; i < n; i++){
+         sorted[i] = i;
+         reversed[i] = n - i;
+      }
+      struct Case{
+         const char* name;
+         void (*run)(int arr[], int n, Count& c);
+         const vector<int>& input;
+         long long comparisons, swaps; // -1: not checked
+      } cases[] = {
+         { "insertionSort count", [](int a[], int m, Count& c){ insertionSort(a, m, c); }, sorted, n - 1, 0 },
+         { "insertionSort count", [](int a[], int m, Count& c){ insertionSort(a, m, c); }, reversed, pairs, pairs },
+         { "bubbleSort count", [](int a[], int m, Count& c){ bubbleSort(a, m, c); }, sorted, n - 1, 0 },
+         { "bubbleSort count", [](int a[], int m, Count& c){ bubbleSort(a, m, c); }, reversed, pairs, pairs },
+         { "selectionSort count", [](int a[], int m, Count& c){ selectionSort(a, m, nullptr, c); }, reversed, pairs, n - 1 },
+         { "heapSort count", [](int a[], int m, Count& c){ heapSort(a, m, c); }, equal, -1, n - 1 },
+         // Up to SMALL elements sort() runs insertion sort, above it finds the input sorted without counting
+         { "sort() count", [](int a[], int m, Count& c){ sorting::sort(a, m, SortOptions(), c); }, sorted,
+           n <= SMALL ? n - 1 : 0, 0 },
+      };
+      for (const Case& t : cases){
+         vector<int> arr = t.input;
+         Count count;
+         t.run(arr.data(), n, count);
+         bool ok = is_sorted(arr.begin(), arr.end()) && count.swaps == t.swaps;
+         check(ok && (t.comparisons < 0 || count.comparisons == t.comparisons), t.name,
+               &t.input == &sorted ? "sorted" : &t.input == &reversed ? "reversed" : "all equal", n);
+      }
+   }
+}
+
+int main(){
+   const int sizes[] = { 0, 1, 2, 3, 5, 16, 31, 32, 33, 64, 100, 257, 1000, 4099 };
+   const Algorithm forced[] = { Algorithm::AUTO, Algorithm::INSERTION, Algorithm::QUICK, Algorithm::MERGE,
+                                Algorithm::HEAP, Algorithm::COUNTING, Algorithm::REVERSE, Algorithm::NONE };
+   mt19937 gen(1);
+   int cases = 0;
+   for (int kind = 0; kind < KINDS; kind++)
+      for (int n : sizes){
+         vector<int> data = makeInput(kind, n, gen), expected = data;
+         std::sort(expected.begin(), expected.end());
+
+         for (Algorithm a : forced)
+            for (bool inPlace : { false, true }){
+               vector<int> arr = data;
+               SortOptions options;
+               options.algorithm = a;
+               options.inPlace = inPlace;
+               Algorithm used = sorting::sort(arr.data(), n, options);
+               check(arr == expected, algorithmName(a), kinds[kind], n);
+               if (inPlace)
+                  check(used != Algorithm::MERGE && used != Algorithm::COUNTING, "inPlace uses no extra memory", kinds[kind], n);
+               cases++;
+            }
+
+         for (const Engine& e : engines){
+            vector<int> arr = data;
+            e.run(arr.data(), n);
+            check(arr == expected, e.name, kinds[kind], n);
+            cases++;
+         }
+
+         // The bounded insertion sort either sorts or stops with the same elements
+         vector<int> arr = data;
+         bool done = insertionSort(arr.data(), n, (long long)n);
+         vector<int> sorted = arr;
+         std::sort(sorted.begin(), sorted.end());
+         check(sorted == expected && (!done || arr == expected), "insertionSort with a move limit", kinds[kind], n);
+
+         checkSearches(expected, kinds[kind]);
+         cases++;
+      }
+   checkLargeSearches(gen);
+   checkMappedSearch(gen);
+   checkMinHeap(gen);
+   checkCounts();
+   cases += 4;
+   cout << cases << " cases, " << failures << " failures" << endl;
+   return failures == 0 ? 0 : 1;
+}
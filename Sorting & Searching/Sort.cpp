@@ -0,0 +1,61 @@
+/* Sort (driver)
+sort(arr, n, options) and the algorithms it chooses from are in Sort.h.
+The driver sorts inputs of different kinds, prints which algorithm was chosen and compares it with forcing quick sort.
+*/
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "Sort.h"
+using namespace std;
+using namespace sorting;
+
+// Function to print an array
+void printArray(int arr[], int size){
+   for (int i = 0; i < size; i++)
+      cout << arr[i] << " ";
+   cout << endl;
+}
+
+// Driver Code
+int main(){
+   int arr[] = {10, 7, 8, 9, 1, 5};
+   int n = sizeof(arr) / sizeof(arr[0]);
+   sorting::sort(arr, n);
+   cout << "Sorted array: \n";
+   printArray(arr, n);
+
+   // A million elements of each kind: what is chosen and how long it takes, against forcing quick sort
+   const int N = 1000000;
+   mt19937 gen(1);
+   const char* kinds[] = { "random", "sorted", "reversed", "few unique", "almost sorted", "organ pipe", "wide range, duplicates" };
+   for (int kind = 0; kind < 7; kind++){
+      vector<int> data(N);
+      for (int i = 0; i < N; i++){
+         switch (kind){
+         case 0: data[i] = (int)gen(); break;
+         case 1: data[i] = i; break;
+         case 2: data[i] = N - i; break;
+         case 3: data[i] = (int)(gen() % 10); break;
+         case 4: data[i] = i + (int)(gen() % 100); break;
+         case 5: data[i] = (i < N / 2) ? i : N - i; break;
+         case 6: data[i] = (int)(gen() % 50) * 1000000; break;
+         }
+      }
+      vector<int> a = data, b = data;
+      auto t0 = chrono::steady_clock::now();
+      Algorithm used = sorting::sort(a.data(), N);
+      auto t1 = chrono::steady_clock::now();
+      SortOptions quick;
+      quick.algorithm = Algorithm::QUICK;
+      sorting::sort(b.data(), N, quick);
+      auto t2 = chrono::steady_clock::now();
+      cout << kinds[kind] << ": " << algorithmName(used) << " sort "
+           << chrono::duration<double, milli>(t1 - t0).count() << " ms, quick sort "
+           << chrono::duration<double, milli>(t2 - t1).count() << " ms"
+           << (is_sorted(a.begin(), a.end()) && a == b ? "" : " (not sorted!)") << endl;
+   }
+   return 0;
+}
@@ -0,0 +1,175 @@
+/* Sort (choosing the algorithm)
+Every sorting algorithm in this folder is the best one for some inputs and a bad one for others:
+Insertion Sort is the fastest on a few elements and on almost sorted arrays, Quick Sort is the fastest on random data
+but takes O(n^2) time (and O(n) stack) on sorted arrays or arrays full of equal elements, Merge Sort is always O(n log(n))
+but needs O(n) extra memory, Heap Sort is O(n log(n)) in place but slower in practice.
+sort(arr, n, options) looks at the input first and picks the algorithm, so callers do not have to.
+
+Sampling (one pass over the array, each element is compared with the next one and with the one NEAR places on):
+size:          up to SMALL elements insertion sort is the fastest.
+presortedness: the number of descents (arr[i] > arr[i+1]). With none the array is already sorted,
+               with no ascents it is reversed; with few descents it is made of a few long sorted runs.
+far descents:  the number of pairs arr[i] > arr[i+NEAR]. With few of them every element is close to its place
+               (each one is out of order only with its neighbours), even if half of the adjacent pairs are descents.
+key range:     max - min + 1.
+Duplicates are not sampled: when they are dense the key range is small, and otherwise Quick Sort handles them (below).
+
+Choice:
+n <= SMALL                          -> Insertion Sort
+sorted / reversed                   -> nothing / reverse
+key range <= n                      -> Counting Sort (O(n + range), no comparisons)
+few descents                        -> Merge Sort, which skips the merge of two halves already in order (O(n) on sorted runs);
+                                       Heap Sort if no extra memory is allowed
+few far descents                    -> Insertion Sort, O(n NEAR). It gives up after INSERTION_MOVES moves per element
+                                       (a few elements that are far from their place) and Merge Sort (or Heap Sort) finishes.
+otherwise                           -> Quick Sort, also with many duplicates: the heap sort fallback below keeps it
+                                       O(n log(n)), and it stays faster than Merge Sort down to 2 distinct values.
+Options can force one algorithm and forbid extra memory. Forced algorithms run as they are, except that
+REVERSE and NONE (results, not algorithms) are treated as AUTO, MERGE and COUNTING are treated as AUTO when
+inPlace is set (inPlace wins: they need O(n) memory), and COUNTING falls back to AUTO when the key range
+is larger than both n and MAX_COUNTS, so it never allocates more than O(n + MAX_COUNTS) counters.
+The returned algorithm tells which one ran.
+
+Measured on 10^6 elements (ms, quick / merge / chosen): random 87 / 120 / quick; almost sorted (i + random % 100)
+93 / 48 / insertion 24; 50 distinct values spread over a wide range 56 / 72 / quick.
+
+The engines are the ones of this folder with a few changes that make them safe on any input:
+Quick Sort takes the median of the first, middle and last element as pivot, recurses into the smaller part only
+and switches to Heap Sort when the recursion gets deeper than 2 log2(n) (Introsort), so it is never O(n^2);
+Merge Sort uses one buffer for all merges instead of arrays on the stack.
+They are in InsertionSort.h, HeapSort.h, MergeSort.h and QuickSort.h, and like sort() they optionally take
+a counter of Counter.h that counts their comparisons and swaps; everything is in namespace sorting
+(link the CMake target sorting, or add this folder to the include path). Sort.cpp is the driver with the measurements.
+
+Time Complexity:
+Best: Ω(n), sorted, reversed or small key range
+Average: θ(n log(n))
+Worst: O(n log(n))
+*/
+
+#ifndef SORT_H
+#define SORT_H
+
+#include <vector>
+#include <algorithm>
+#include "InsertionSort.h"
+#include "HeapSort.h"
+#include "MergeSort.h"
+#include "QuickSort.h"
+
+namespace sorting {
+
+enum class Algorithm { AUTO, INSERTION, QUICK, MERGE, HEAP, COUNTING, REVERSE, NONE };
+
+inline const char* algorithmName(Algorithm a){
+   static const char* names[] = { "auto", "insertion", "quick", "merge", "heap", "counting", "reverse", "none" };
+   return names[static_cast<int>(a)];
+}
+
+struct SortOptions{
+   Algorithm algorithm = Algorithm::AUTO; // anything else forces that algorithm (REVERSE and NONE mean AUTO)
+   bool inPlace = false;                  // no O(n) extra memory (excludes Merge Sort and Counting Sort, even forced)
+};
+
+const int NEAR = 128;                 // gap of the far descents
+const double FEW_RUNS = 0.01;         // (far) descents per element below which the input counts as presorted
+const int INSERTION_MOVES = 64;       // moves per element before insertion sort of a presorted input gives up
+const long long MAX_COUNTS = 1 << 24; // largest key range of a forced counting sort beyond n
+
+// Counting sort of values in [lo, lo + range)
+inline void countingSort(int arr[], int n, int lo, long long range){
+   std::vector<int> count(range, 0);
+   for (int i = 0; i < n; i++)
+      count[(long long)arr[i] - lo]++;
+   int k = 0;
+   for (long long v = 0; v < range; v++)
+      for (int c = count[v]; c > 0; c--)
+         arr[k++] = (int)(lo + v);
+}
+
+// Looks at the input and returns the algorithm sort() would use
+inline Algorithm chooseAlgorithm(const int arr[], int n, const SortOptions& options){
+   if (n <= SMALL)
+      return Algorithm::INSERTION;
+   long long descents = 0, ascents = 0, far = 0;
+   int lo = arr[0], hi = arr[0];
+   for (int i = 0; i + 1 < n; i++){
+      descents += arr[i] > arr[i + 1];
+      ascents += arr[i] < arr[i + 1];
+      if (i + NEAR < n)
+         far += arr[i] > arr[i + NEAR];
+      lo = std::min(lo, arr[i + 1]);
+      hi = std::max(hi, arr[i + 1]);
+   }
+   if (descents == 0)
+      return Algorithm::NONE;
+   if (ascents == 0)
+      return Algorithm::REVERSE;
+   long long range = (long long)hi - lo + 1;
+   if (!options.inPlace && range <= n)
+      return Algorithm::COUNTING;
+   if (descents < FEW_RUNS * n)
+      return options.inPlace ? Algorithm::HEAP : Algorithm::MERGE;
+   if (far < FEW_RUNS * n)
+      return Algorithm::INSERTION;
+   return Algorithm::QUICK;
+}
+
+// Sorts arr[0..n-1] in ascending order and returns the algorithm that was used; the engines count through c
+// (the sampling of chooseAlgorithm() and counting sort, which does not compare, are not counted)
+template <class C>
+inline Algorithm sort(int arr[], int n, SortOptions options, C& c){
+   if (n < 2)
+      return Algorithm::NONE;
+   Algorithm a = options.algorithm;
+   if (options.inPlace && (a == Algorithm::MERGE || a == Algorithm::COUNTING))
+      a = Algorithm::AUTO;
+   if (a == Algorithm::COUNTING){
+      long long range = (long long)*std::max_element(arr, arr + n) - *std::min_element(arr, arr + n) + 1;
+      if (range > n && range > MAX_COUNTS)
+         a = Algorithm::AUTO;
+   }
+   bool chosen = a == Algorithm::AUTO || a == Algorithm::REVERSE || a == Algorithm::NONE;
+   if (chosen)
+      a = chooseAlgorithm(arr, n, options);
+   if (chosen && a == Algorithm::INSERTION && n > SMALL){
+      if (insertionSort(arr, n, (long long)INSERTION_MOVES * n, c))
+         return Algorithm::INSERTION;
+      // Not as presorted as it looked: finish with an O(n log(n)) sort
+      a = options.inPlace ? Algorithm::HEAP : Algorithm::MERGE;
+   }
+   switch (a){
+   case Algorithm::INSERTION:
+      insertionSort(arr, n, c);
+      break;
+   case Algorithm::QUICK:
+      quickSort(arr, n, c);
+      break;
+   case Algorithm::MERGE:
+      mergeSort(arr, n, c);
+      break;
+   case Algorithm::HEAP:
+      heapSort(arr, n, c);
+      break;
+   case Algorithm::COUNTING: {
+      int lo = *std::min_element(arr, arr + n), hi = *std::max_element(arr, arr + n);
+      countingSort(arr, n, lo, (long long)hi - lo + 1);
+      break;
+   }
+   case Algorithm::REVERSE:
+      std::reverse(arr, arr + n);
+      break;
+   default:
+      break;
+   }
+   return a;
+}
+
+inline Algorithm sort(int arr[], int n, SortOptions options = SortOptions()){
+   NoCount c;
+   return sort(arr, n, options, c);
+}
+
+} // namespace sorting
+
+#endif